@@ -2,1073 +2,745 @@
 *       The E text editor - 3rd incarnation      *
 *************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2023 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 /* Written by Philip Hazel, starting November 1991 */
 
-/* This file is generated by the mptable program. It defines a table
-of bits that identifies which Unicode characters in the range 0 to
-0xffff are displayable. A one bit means 'not displayable'. These are
-the non-displayable ranges:
+/* This file is generated by the mptable program, using wcwidth(). It defines
+a three-stage table of the screen widths of Unicode characters, and
+the function that looks them up. A width of 0 means 'not displayable';
+these are control characters, combining characters, and unassigned
+code points. These are the ranges of characters of width 2:
 
-0000-001f 007f-009f 0300-036f 0483-0489 0591-05bd 05bf-05bf 05c1-05c2 05c4-05c5
-05c7-05c7 0600-0605 0610-061a 061c-061c 064b-065f 0670-0670 06d6-06dd 06df-06e4
-06e7-06e8 06ea-06ed 070f-070f 0711-0711 0730-074a 07a6-07b0 07eb-07f3 07fd-07fd
-0816-0819 081b-0823 0825-0827 0829-082d 0859-085b 0898-089f 08ca-08e1 08e3-0902
-093a-093a 093c-093c 0941-0948 094d-094d 0951-0957 0962-0963 0981-0981 09bc-09bc
-09c1-09c4 09cd-09cd 09e2-09e3 09fe-09fe 0a01-0a02 0a3c-0a3c 0a41-0a42 0a47-0a48
-0a4b-0a4d 0a51-0a51 0a70-0a71 0a75-0a75 0a81-0a82 0abc-0abc 0ac1-0ac5 0ac7-0ac8
-0acd-0acd 0ae2-0ae3 0afa-0aff 0b01-0b01 0b3c-0b3c 0b3f-0b3f 0b41-0b44 0b4d-0b4d
-0b55-0b56 0b62-0b63 0b82-0b82 0bc0-0bc0 0bcd-0bcd 0c00-0c00 0c04-0c04 0c3c-0c3c
-0c3e-0c40 0c46-0c48 0c4a-0c4d 0c55-0c56 0c62-0c63 0c81-0c81 0cbc-0cbc 0cbf-0cbf
-0cc6-0cc6 0ccc-0ccd 0ce2-0ce3 0d00-0d01 0d3b-0d3c 0d41-0d44 0d4d-0d4d 0d62-0d63
-0d81-0d81 0dca-0dca 0dd2-0dd4 0dd6-0dd6 0e31-0e31 0e34-0e3a 0e47-0e4e 0eb1-0eb1
-0eb4-0ebc 0ec8-0ecd 0f18-0f19 0f35-0f35 0f37-0f37 0f39-0f39 0f71-0f7e 0f80-0f84
-0f86-0f87 0f8d-0f97 0f99-0fbc 0fc6-0fc6 102d-1030 1032-1037 1039-103a 103d-103e
-1058-1059 105e-1060 1071-1074 1082-1082 1085-1086 108d-108d 109d-109d 1100-11ff
-135d-135f 1712-1714 1732-1733 1752-1753 1772-1773 17b4-17b5 17b7-17bd 17c6-17c6
-17c9-17d3 17dd-17dd 180b-180d 180f-180f 1885-1886 18a9-18a9 1920-1922 1927-1928
-1932-1932 1939-193b 1a17-1a18 1a1b-1a1b 1a56-1a56 1a58-1a5e 1a60-1a60 1a62-1a62
-1a65-1a6c 1a73-1a7c 1a7f-1a7f 1ab0-1ace 1b00-1b03 1b34-1b34 1b36-1b3a 1b3c-1b3c
-1b42-1b42 1b6b-1b73 1b80-1b81 1ba2-1ba5 1ba8-1ba9 1bab-1bad 1be6-1be6 1be8-1be9
-1bed-1bed 1bef-1bf1 1c2c-1c33 1c36-1c37 1cd0-1cd2 1cd4-1ce0 1ce2-1ce8 1ced-1ced
-1cf4-1cf4 1cf8-1cf9 1dc0-1dff 20d0-20f0 231a-231b 2329-232a 23e9-23ec 23f0-23f0
-23f3-23f3 25fd-25fe 2614-2615 2648-2653 267f-267f 2693-2693 26a1-26a1 26aa-26ab
-26bd-26be 26c4-26c5 26ce-26ce 26d4-26d4 26ea-26ea 26f2-26f3 26f5-26f5 26fa-26fa
-26fd-26fd 2705-2705 270a-270b 2728-2728 274c-274c 274e-274e 2753-2755 2757-2757
-2795-2797 27b0-27b0 27bf-27bf 2b1b-2b1c 2b50-2b50 2b55-2b55 2cef-2cf1 2d7f-2d7f
-2de0-2dff 2e80-2e99 2e9b-2ef3 2f00-2fd5 2ff0-2ffb 3000-303e 3041-3096 3099-30ff
-3105-312f 3131-318e 3190-31e3 31f0-321e 3220-3247 3250-4dbf 4e00-a48c a490-a4c6
-a66f-a672 a674-a67d a69e-a69f a6f0-a6f1 a802-a802 a806-a806 a80b-a80b a825-a826
-a82c-a82c a8c4-a8c5 a8e0-a8f1 a8ff-a8ff a926-a92d a947-a951 a960-a97c a980-a982
-a9b3-a9b3 a9b6-a9b9 a9bc-a9bd a9e5-a9e5 aa29-aa2e aa31-aa32 aa35-aa36 aa43-aa43
-aa4c-aa4c aa7c-aa7c aab0-aab0 aab2-aab4 aab7-aab8 aabe-aabf aac1-aac1 aaec-aaed
-aaf6-aaf6 abe5-abe5 abe8-abe8 abed-abed ac00-d7a3 d7b0-d7c6 d7cb-d7fb f900-faff
-fb1e-fb1e fe00-fe19 fe20-fe52 fe54-fe66 fe68-fe6b ff01-ff60 ffe0-ffe6 */
+1100-115f 231a-231b 2329-232a 23e9-23ec 23f0-23f0 23f3-23f3
+25fd-25fe 2614-2615 2648-2653 267f-267f 2693-2693 26a1-26a1
+26aa-26ab 26bd-26be 26c4-26c5 26ce-26ce 26d4-26d4 26ea-26ea
+26f2-26f3 26f5-26f5 26fa-26fa 26fd-26fd 2705-2705 270a-270b
+2728-2728 274c-274c 274e-274e 2753-2755 2757-2757 2795-2797
+27b0-27b0 27bf-27bf 2b1b-2b1c 2b50-2b50 2b55-2b55 2e80-2e99
+2e9b-2ef3 2f00-2fd5 2ff0-2ffb 3000-3029 302e-303e 3041-3096
+309b-30ff 3105-312f 3131-318e 3190-31e3 31f0-321e 3220-a48c
+a490-a4c6 a960-a97c ac00-d7a3 f900-fa6d fa70-fad9 fe10-fe19
+fe30-fe52 fe54-fe66 fe68-fe6b ff01-ff60 ffe0-ffe6 16fe0-16fe3
+16ff0-16ff1 17000-187f7 18800-18cd5 18d00-18d08 1aff0-1aff3 1aff5-1affb
+1affd-1affe 1b000-1b122 1b150-1b152 1b164-1b167 1b170-1b2fb 1f004-1f004
+1f0cf-1f0cf 1f18e-1f18e 1f191-1f19a 1f200-1f202 1f210-1f23b 1f240-1f248
+1f250-1f251 1f260-1f265 1f300-1f320 1f32d-1f335 1f337-1f37c 1f37e-1f393
+1f3a0-1f3ca 1f3cf-1f3d3 1f3e0-1f3f0 1f3f4-1f3f4 1f3f8-1f43e 1f440-1f440
+1f442-1f4fc 1f4ff-1f53d 1f54b-1f54e 1f550-1f567 1f57a-1f57a 1f595-1f596
+1f5a4-1f5a4 1f5fb-1f64f 1f680-1f6c5 1f6cc-1f6cc 1f6d0-1f6d2 1f6d5-1f6d7
+1f6dd-1f6df 1f6eb-1f6ec 1f6f4-1f6fc 1f7e0-1f7eb 1f7f0-1f7f0 1f90c-1f93a
+1f93c-1f945 1f947-1f9ff 1fa70-1fa74 1fa78-1fa7c 1fa80-1fa86 1fa90-1faac
+1fab0-1faba 1fac0-1fac5 1fad0-1fad9 1fae0-1fae7 1faf0-1faf6 20000-2a6df
+2a700-2b738 2b740-2b81d 2b820-2cea1 2ceb0-2ebe0 2f800-2fa1d 30000-3134a
+
+There are 144 different blocks and 6 different rows. */
 
 #include "ehdr.h"
 
-uschar ch_displayable[] = {
-  0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,  /* 0000 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,  /* 0040 */
-  0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,  /* 0080 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 00c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 0100 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 0140 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 0180 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 01c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 0200 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 0240 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 0280 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 02c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 0300 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,  /* 0340 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 0380 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 03c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 0400 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 0440 */
-  0xf8,0x03,0x00,0x00,0x00,0x00,0x00,0x00,  /* 0480 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 04c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 0500 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 0540 */
-  0x00,0x00,0xfe,0xff,0xff,0xff,0xff,0xbf,  /* 0580 */
-  0xb6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 05c0 */
-  0x3f,0x00,0xff,0x17,0x00,0x00,0x00,0x00,  /* 0600 */
-  0x00,0xf8,0xff,0xff,0x00,0x00,0x01,0x00,  /* 0640 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 0680 */
-  0x00,0x00,0xc0,0xbf,0x9f,0x3d,0x00,0x00,  /* 06c0 */
-  0x00,0x80,0x02,0x00,0x00,0x00,0xff,0xff,  /* 0700 */
-  0xff,0x07,0x00,0x00,0x00,0x00,0x00,0x00,  /* 0740 */
-  0x00,0x00,0x00,0x00,0xc0,0xff,0x01,0x00,  /* 0780 */
-  0x00,0x00,0x00,0x00,0x00,0xf8,0x0f,0x20,  /* 07c0 */
-  0x00,0x00,0xc0,0xfb,0xef,0x3e,0x00,0x00,  /* 0800 */
-  0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,  /* 0840 */
-  0x00,0x00,0x00,0xff,0x00,0x00,0x00,0x00,  /* 0880 */
-  0x00,0xfc,0xff,0xff,0xfb,0xff,0xff,0xff,  /* 08c0 */
-  0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x14,  /* 0900 */
-  0xfe,0x21,0xfe,0x00,0x0c,0x00,0x00,0x00,  /* 0940 */
-  0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x10,  /* 0980 */
-  0x1e,0x20,0x00,0x00,0x0c,0x00,0x00,0x40,  /* 09c0 */
-  0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x10,  /* 0a00 */
-  0x86,0x39,0x02,0x00,0x00,0x00,0x23,0x00,  /* 0a40 */
-  0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x10,  /* 0a80 */
-  0xbe,0x21,0x00,0x00,0x0c,0x00,0x00,0xfc,  /* 0ac0 */
-  0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x90,  /* 0b00 */
-  0x1e,0x20,0x60,0x00,0x0c,0x00,0x00,0x00,  /* 0b40 */
-  0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 0b80 */
-  0x01,0x20,0x00,0x00,0x00,0x00,0x00,0x00,  /* 0bc0 */
-  0x11,0x00,0x00,0x00,0x00,0x00,0x00,0xd0,  /* 0c00 */
-  0xc1,0x3d,0x60,0x00,0x0c,0x00,0x00,0x00,  /* 0c40 */
-  0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x90,  /* 0c80 */
-  0x40,0x30,0x00,0x00,0x0c,0x00,0x00,0x00,  /* 0cc0 */
-  0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x18,  /* 0d00 */
-  0x1e,0x20,0x00,0x00,0x0c,0x00,0x00,0x00,  /* 0d40 */
-  0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 0d80 */
-  0x00,0x04,0x5c,0x00,0x00,0x00,0x00,0x00,  /* 0dc0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0xf2,0x07,  /* 0e00 */
-  0x80,0x7f,0x00,0x00,0x00,0x00,0x00,0x00,  /* 0e40 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0xf2,0x1f,  /* 0e80 */
-  0x00,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,  /* 0ec0 */
-  0x00,0x00,0x00,0x03,0x00,0x00,0xa0,0x02,  /* 0f00 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0x7f,  /* 0f40 */
-  0xdf,0xe0,0xff,0xfe,0xff,0xff,0xff,0x1f,  /* 0f80 */
-  0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 0fc0 */
-  0x00,0x00,0x00,0x00,0x00,0xe0,0xfd,0x66,  /* 1000 */
-  0x00,0x00,0x00,0xc3,0x01,0x00,0x1e,0x00,  /* 1040 */
-  0x64,0x20,0x00,0x20,0x00,0x00,0x00,0x00,  /* 1080 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 10c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 1100 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 1140 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 1180 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 11c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1200 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1240 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1280 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 12c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1300 */
-  0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,  /* 1340 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1380 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 13c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1400 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1440 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1480 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 14c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1500 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1540 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1580 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 15c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1600 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1640 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1680 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 16c0 */
-  0x00,0x00,0x1c,0x00,0x00,0x00,0x0c,0x00,  /* 1700 */
-  0x00,0x00,0x0c,0x00,0x00,0x00,0x0c,0x00,  /* 1740 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0xb0,0x3f,  /* 1780 */
-  0x40,0xfe,0x0f,0x20,0x00,0x00,0x00,0x00,  /* 17c0 */
-  0x00,0xb8,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1800 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1840 */
-  0x60,0x00,0x00,0x00,0x00,0x02,0x00,0x00,  /* 1880 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 18c0 */
-  0x00,0x00,0x00,0x00,0x87,0x01,0x04,0x0e,  /* 1900 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1940 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1980 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 19c0 */
-  0x00,0x00,0x80,0x09,0x00,0x00,0x00,0x00,  /* 1a00 */
-  0x00,0x00,0x40,0x7f,0xe5,0x1f,0xf8,0x9f,  /* 1a40 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,  /* 1a80 */
-  0xff,0x7f,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1ac0 */
-  0x0f,0x00,0x00,0x00,0x00,0x00,0xd0,0x17,  /* 1b00 */
-  0x04,0x00,0x00,0x00,0x00,0xf8,0x0f,0x00,  /* 1b40 */
-  0x03,0x00,0x00,0x00,0x3c,0x3b,0x00,0x00,  /* 1b80 */
-  0x00,0x00,0x00,0x00,0x40,0xa3,0x03,0x00,  /* 1bc0 */
-  0x00,0x00,0x00,0x00,0x00,0xf0,0xcf,0x00,  /* 1c00 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1c40 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1c80 */
-  0x00,0x00,0xf7,0xff,0xfd,0x21,0x10,0x03,  /* 1cc0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1d00 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1d40 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1d80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 1dc0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1e00 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1e40 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1e80 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1ec0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1f00 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1f40 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1f80 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 1fc0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2000 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2040 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2080 */
-  0x00,0x00,0xff,0xff,0xff,0xff,0x01,0x00,  /* 20c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2100 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2140 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2180 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 21c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2200 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2240 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2280 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 22c0 */
-  0x00,0x00,0x00,0x0c,0x00,0x06,0x00,0x00,  /* 2300 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2340 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2380 */
-  0x00,0x00,0x00,0x00,0x00,0x1e,0x09,0x00,  /* 23c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2400 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2440 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2480 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 24c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2500 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2540 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2580 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,  /* 25c0 */
-  0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,  /* 2600 */
-  0x00,0xff,0x0f,0x00,0x00,0x00,0x00,0x80,  /* 2640 */
-  0x00,0x00,0x08,0x00,0x02,0x0c,0x00,0x60,  /* 2680 */
-  0x30,0x40,0x10,0x00,0x00,0x04,0x2c,0x24,  /* 26c0 */
-  0x20,0x0c,0x00,0x00,0x00,0x01,0x00,0x00,  /* 2700 */
-  0x00,0x50,0xb8,0x00,0x00,0x00,0x00,0x00,  /* 2740 */
-  0x00,0x00,0xe0,0x00,0x00,0x00,0x01,0x80,  /* 2780 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 27c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2800 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2840 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2880 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 28c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2900 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2940 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2980 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 29c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2a00 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2a40 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2a80 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2ac0 */
-  0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,  /* 2b00 */
-  0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,  /* 2b40 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2b80 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2bc0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2c00 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2c40 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2c80 */
-  0x00,0x00,0x00,0x00,0x00,0x80,0x03,0x00,  /* 2cc0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2d00 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,  /* 2d40 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2d80 */
-  0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,  /* 2dc0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2e00 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 2e40 */
-  0xff,0xff,0xff,0xfb,0xff,0xff,0xff,0xff,  /* 2e80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0x0f,0x00,  /* 2ec0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 2f00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 2f40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 2f80 */
-  0xff,0xff,0x3f,0x00,0x00,0x00,0xff,0x0f,  /* 2fc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,  /* 3000 */
-  0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3040 */
-  0xff,0xff,0x7f,0xfe,0xff,0xff,0xff,0xff,  /* 3080 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 30c0 */
-  0xe0,0xff,0xff,0xff,0xff,0xff,0xfe,0xff,  /* 3100 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3140 */
-  0xff,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3180 */
-  0xff,0xff,0xff,0xff,0x0f,0x00,0xff,0xff,  /* 31c0 */
-  0xff,0xff,0xff,0x7f,0xff,0xff,0xff,0xff,  /* 3200 */
-  0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3240 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3280 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 32c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3300 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3340 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3380 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 33c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3400 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3440 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3480 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 34c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3500 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3540 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3580 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 35c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3600 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3640 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3680 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 36c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3700 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3740 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3780 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 37c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3800 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3840 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3880 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 38c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3900 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3940 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3980 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 39c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3a00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3a40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3a80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3ac0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3b00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3b40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3b80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3bc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3c00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3c40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3c80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3cc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3d00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3d40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3d80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3dc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3e00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3e40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3e80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3ec0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3f00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3f40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3f80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 3fc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4000 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4040 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4080 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 40c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4100 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4140 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4180 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 41c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4200 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4240 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4280 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 42c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4300 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4340 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4380 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 43c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4400 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4440 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4480 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 44c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4500 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4540 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4580 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 45c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4600 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4640 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4680 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 46c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4700 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4740 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4780 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 47c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4800 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4840 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4880 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 48c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4900 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4940 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4980 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 49c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4a00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4a40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4a80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4ac0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4b00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4b40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4b80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4bc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4c00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4c40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4c80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4cc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4d00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4d40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4d80 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* 4dc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4e00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4e40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4e80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4ec0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4f00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4f40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4f80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 4fc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5000 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5040 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5080 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 50c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5100 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5140 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5180 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 51c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5200 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5240 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5280 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 52c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5300 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5340 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5380 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 53c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5400 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5440 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5480 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 54c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5500 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5540 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5580 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 55c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5600 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5640 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5680 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 56c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5700 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5740 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5780 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 57c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5800 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5840 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5880 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 58c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5900 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5940 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5980 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 59c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5a00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5a40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5a80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5ac0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5b00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5b40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5b80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5bc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5c00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5c40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5c80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5cc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5d00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5d40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5d80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5dc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5e00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5e40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5e80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5ec0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5f00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5f40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5f80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 5fc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6000 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6040 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6080 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 60c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6100 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6140 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6180 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 61c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6200 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6240 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6280 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 62c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6300 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6340 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6380 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 63c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6400 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6440 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6480 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 64c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6500 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6540 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6580 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 65c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6600 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6640 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6680 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 66c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6700 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6740 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6780 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 67c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6800 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6840 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6880 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 68c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6900 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6940 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6980 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 69c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6a00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6a40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6a80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6ac0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6b00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6b40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6b80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6bc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6c00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6c40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6c80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6cc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6d00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6d40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6d80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6dc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6e00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6e40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6e80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6ec0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6f00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6f40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6f80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 6fc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7000 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7040 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7080 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 70c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7100 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7140 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7180 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 71c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7200 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7240 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7280 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 72c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7300 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7340 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7380 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 73c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7400 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7440 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7480 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 74c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7500 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7540 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7580 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 75c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7600 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7640 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7680 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 76c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7700 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7740 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7780 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 77c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7800 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7840 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7880 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 78c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7900 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7940 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7980 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 79c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7a00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7a40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7a80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7ac0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7b00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7b40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7b80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7bc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7c00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7c40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7c80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7cc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7d00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7d40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7d80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7dc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7e00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7e40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7e80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7ec0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7f00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7f40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7f80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 7fc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8000 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8040 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8080 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 80c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8100 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8140 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8180 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 81c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8200 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8240 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8280 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 82c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8300 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8340 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8380 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 83c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8400 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8440 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8480 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 84c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8500 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8540 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8580 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 85c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8600 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8640 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8680 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 86c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8700 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8740 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8780 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 87c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8800 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8840 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8880 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 88c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8900 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8940 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8980 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 89c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8a00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8a40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8a80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8ac0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8b00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8b40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8b80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8bc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8c00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8c40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8c80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8cc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8d00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8d40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8d80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8dc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8e00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8e40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8e80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8ec0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8f00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8f40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8f80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 8fc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9000 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9040 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9080 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 90c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9100 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9140 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9180 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 91c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9200 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9240 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9280 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 92c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9300 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9340 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9380 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 93c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9400 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9440 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9480 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 94c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9500 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9540 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9580 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 95c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9600 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9640 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9680 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 96c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9700 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9740 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9780 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 97c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9800 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9840 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9880 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 98c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9900 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9940 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9980 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 99c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9a00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9a40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9a80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9ac0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9b00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9b40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9b80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9bc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9c00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9c40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9c80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9cc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9d00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9d40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9d80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9dc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9e00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9e40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9e80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9ec0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9f00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9f40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9f80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* 9fc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* a000 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* a040 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* a080 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* a0c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* a100 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* a140 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* a180 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* a1c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* a200 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* a240 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* a280 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* a2c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* a300 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* a340 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* a380 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* a3c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* a400 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* a440 */
-  0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,  /* a480 */
-  0x7f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* a4c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* a500 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* a540 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* a580 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* a5c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* a600 */
-  0x00,0x00,0x00,0x00,0x00,0x80,0xf7,0x3f,  /* a640 */
-  0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x00,  /* a680 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,  /* a6c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* a700 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* a740 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* a780 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* a7c0 */
-  0x44,0x08,0x00,0x00,0x60,0x10,0x00,0x00,  /* a800 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* a840 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* a880 */
-  0x30,0x00,0x00,0x00,0xff,0xff,0x03,0x80,  /* a8c0 */
-  0x00,0x00,0x00,0x00,0xc0,0x3f,0x00,0x00,  /* a900 */
-  0x80,0xff,0x03,0x00,0xff,0xff,0xff,0x1f,  /* a940 */
-  0x07,0x00,0x00,0x00,0x00,0x00,0xc8,0x33,  /* a980 */
-  0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,  /* a9c0 */
-  0x00,0x00,0x00,0x00,0x00,0x7e,0x66,0x00,  /* aa00 */
-  0x08,0x10,0x00,0x00,0x00,0x00,0x00,0x10,  /* aa40 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x9d,0xc1,  /* aa80 */
-  0x02,0x00,0x00,0x00,0x00,0x30,0x40,0x00,  /* aac0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* ab00 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* ab40 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* ab80 */
-  0x00,0x00,0x00,0x00,0x20,0x21,0x00,0x00,  /* abc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* ac00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* ac40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* ac80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* acc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* ad00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* ad40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* ad80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* adc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* ae00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* ae40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* ae80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* aec0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* af00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* af40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* af80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* afc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b000 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b040 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b080 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b0c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b100 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b140 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b180 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b1c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b200 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b240 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b280 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b2c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b300 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b340 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b380 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b3c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b400 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b440 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b480 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b4c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b500 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b540 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b580 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b5c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b600 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b640 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b680 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b6c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b700 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b740 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b780 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b7c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b800 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b840 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b880 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b8c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b900 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b940 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b980 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* b9c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* ba00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* ba40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* ba80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* bac0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* bb00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* bb40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* bb80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* bbc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* bc00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* bc40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* bc80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* bcc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* bd00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* bd40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* bd80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* bdc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* be00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* be40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* be80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* bec0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* bf00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* bf40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* bf80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* bfc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c000 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c040 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c080 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c0c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c100 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c140 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c180 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c1c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c200 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c240 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c280 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c2c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c300 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c340 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c380 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c3c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c400 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c440 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c480 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c4c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c500 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c540 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c580 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c5c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c600 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c640 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c680 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c6c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c700 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c740 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c780 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c7c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c800 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c840 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c880 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c8c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c900 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c940 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c980 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* c9c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* ca00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* ca40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* ca80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* cac0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* cb00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* cb40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* cb80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* cbc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* cc00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* cc40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* cc80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* ccc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* cd00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* cd40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* cd80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* cdc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* ce00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* ce40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* ce80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* cec0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* cf00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* cf40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* cf80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* cfc0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* d000 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* d040 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* d080 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* d0c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* d100 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* d140 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* d180 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* d1c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* d200 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* d240 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* d280 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* d2c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* d300 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* d340 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* d380 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* d3c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* d400 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* d440 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* d480 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* d4c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* d500 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* d540 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* d580 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* d5c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* d600 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* d640 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* d680 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* d6c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* d700 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* d740 */
-  0xff,0xff,0xff,0xff,0x0f,0x00,0xff,0xff,  /* d780 */
-  0x7f,0xf8,0xff,0xff,0xff,0xff,0xff,0x0f,  /* d7c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* d800 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* d840 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* d880 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* d8c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* d900 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* d940 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* d980 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* d9c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* da00 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* da40 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* da80 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* dac0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* db00 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* db40 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* db80 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* dbc0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* dc00 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* dc40 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* dc80 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* dcc0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* dd00 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* dd40 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* dd80 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* ddc0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* de00 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* de40 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* de80 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* dec0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* df00 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* df40 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* df80 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* dfc0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e000 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e040 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e080 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e0c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e100 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e140 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e180 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e1c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e200 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e240 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e280 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e2c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e300 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e340 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e380 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e3c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e400 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e440 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e480 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e4c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e500 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e540 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e580 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e5c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e600 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e640 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e680 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e6c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e700 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e740 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e780 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e7c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e800 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e840 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e880 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e8c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e900 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e940 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e980 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* e9c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* ea00 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* ea40 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* ea80 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* eac0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* eb00 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* eb40 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* eb80 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* ebc0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* ec00 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* ec40 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* ec80 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* ecc0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* ed00 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* ed40 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* ed80 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* edc0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* ee00 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* ee40 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* ee80 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* eec0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* ef00 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* ef40 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* ef80 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* efc0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f000 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f040 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f080 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f0c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f100 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f140 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f180 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f1c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f200 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f240 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f280 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f2c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f300 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f340 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f380 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f3c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f400 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f440 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f480 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f4c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f500 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f540 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f580 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f5c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f600 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f640 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f680 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f6c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f700 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f740 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f780 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f7c0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f800 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f840 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f880 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* f8c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* f900 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* f940 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* f980 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* f9c0 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* fa00 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* fa40 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* fa80 */
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* fac0 */
-  0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,  /* fb00 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* fb40 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* fb80 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* fbc0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* fc00 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* fc40 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* fc80 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* fcc0 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* fd00 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* fd40 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* fd80 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* fdc0 */
-  0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,  /* fe00 */
-  0xff,0xff,0xf7,0xff,0x7f,0x0f,0x00,0x00,  /* fe40 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* fe80 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* fec0 */
-  0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,  /* ff00 */
-  0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,  /* ff40 */
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  /* ff80 */
-  0x00,0x00,0x00,0x00,0x7f,0x00,0x00,0x00}; /* ffc0 */
+/* Row number for each plane */
+
+static const uschar ch_width_planes[] = {
+  0,1,2,3,4,4,4,4,4,4,4,4,4,4,4,5,5 };
+
+/* Block number for each 256 characters in a plane */
+
+static const uschar ch_width_rows[][256] = {
+  {  0,  1,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18,  1,  1, 19, 20, 21, 22, 23, 24, 25, 26,  1, 27,
+    28, 29,  1, 30, 31, 32, 33, 34,  1,  1,  1, 35, 36, 37, 38, 39,
+    40, 41, 42, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 44,  1, 45, 46, 47, 48, 49, 50, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 51, 52, 52, 52, 52, 52, 52, 52, 52,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1, 43, 53, 54,  1, 55, 56, 57 },
+  { 58, 59, 60, 61, 62, 63,  1, 64, 65, 66, 67, 68, 69, 70, 71, 72,
+    73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 52, 84, 85, 86, 87,
+     1,  1,  1, 88, 89, 90, 52, 52, 52, 52, 52, 52, 52, 52, 52, 91,
+     1,  1,  1,  1, 92, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52,  1,  1, 93, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52,  1,  1, 94, 95, 52, 52, 96, 97,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 98, 43, 43, 43, 43, 99,100, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,101,
+    43,102,103, 52, 52, 52, 52, 52, 52, 52, 52, 52,104, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,105,
+   106,107,108,109,110,111,112,113,  1,  1,114, 52, 52, 52, 52,115,
+    52,116,117, 52, 52, 52, 52,118,119,120, 52, 52,121,122,123, 52,
+   124,125,126,127,128,129,130,131,132,133,134,135, 52, 52, 52, 52 },
+  { 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43,136, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43,137,138, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,139, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,140, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 43, 43,141, 52, 52, 52, 52, 52 },
+  { 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43,142, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52 },
+  { 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52 },
+  {  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,143 }
+};
+
+/* Two bits of width for each of 256 characters */
+
+static const uschar ch_width_blocks[][64] = {
+  {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },  /* 0 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },  /* 1 */
+  {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x50,0x55,
+   0x00,0x55,0x15,0x51,0x55,0x55,0x55,0x55,0x45,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },  /* 2 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x15,0x00,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },  /* 3 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x54,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x15,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x15,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,
+   0x41,0x10,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x40,0x55,0x01,0x00,0x00 },  /* 4 */
+  {0x55,0x55,0x55,0x55,0x00,0x00,0x40,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x15,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x55,0x54,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x05,0x00,0x14,0x00,0x14,0x04,0x50,0x55,0x55,0x55,0x55 },  /* 5 */
+  {0x55,0x55,0x55,0x45,0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x00,0x00,0x04,0x00,0x00,0x00,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x00,0x55,0x15,0x50 },  /* 6 */
+  {0x55,0x55,0x55,0x55,0x55,0x05,0x10,0x00,0x00,0x01,0x01,0x00,0x55,0x55,0x55,0x15,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x01,0x10,0x55,0x55,0x15,0x00,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x15,0x05,0x00,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x05,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 7 */
+  {0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x45,0x54,
+   0x01,0x00,0x54,0x51,0x01,0x00,0x55,0x55,0x05,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x51,0x54,0x55,0x41,0x41,0x55,0x55,0x55,0x55,0x55,0x51,0x55,0x11,0x50,0x05,0x54,
+   0x01,0x40,0x41,0x11,0x00,0x40,0x00,0x45,0x05,0x50,0x55,0x55,0x55,0x55,0x55,0x05 },  /* 8 */
+  {0x40,0x54,0x15,0x40,0x41,0x55,0x55,0x55,0x55,0x55,0x51,0x55,0x51,0x14,0x05,0x50,
+   0x01,0x00,0x00,0x00,0x00,0x00,0x54,0x11,0x00,0x50,0x55,0x55,0x50,0x11,0x00,0x00,
+   0x40,0x54,0x55,0x45,0x45,0x55,0x55,0x55,0x55,0x55,0x51,0x55,0x51,0x54,0x05,0x54,
+   0x01,0x00,0x44,0x01,0x01,0x00,0x00,0x00,0x05,0x50,0x55,0x55,0x05,0x00,0x04,0x00 },  /* 9 */
+  {0x50,0x54,0x55,0x41,0x41,0x55,0x55,0x55,0x55,0x55,0x51,0x55,0x51,0x54,0x05,0x14,
+   0x01,0x40,0x41,0x01,0x00,0x40,0x00,0x45,0x05,0x50,0x55,0x55,0x55,0x55,0x00,0x00,
+   0x40,0x54,0x15,0x50,0x51,0x05,0x14,0x51,0x40,0x01,0x15,0x50,0x55,0x55,0x05,0x50,
+   0x14,0x50,0x51,0x01,0x01,0x40,0x00,0x00,0x00,0x50,0x55,0x55,0x55,0x55,0x15,0x00 },  /* 10 */
+  {0x54,0x54,0x55,0x51,0x51,0x55,0x55,0x55,0x55,0x55,0x51,0x55,0x55,0x55,0x05,0x04,
+   0x54,0x01,0x00,0x00,0x00,0x00,0x15,0x04,0x05,0x50,0x55,0x55,0x00,0x40,0x55,0x55,
+   0x51,0x55,0x55,0x51,0x51,0x55,0x55,0x55,0x55,0x55,0x51,0x55,0x55,0x54,0x05,0x14,
+   0x55,0x41,0x51,0x00,0x00,0x14,0x00,0x14,0x05,0x50,0x55,0x55,0x14,0x00,0x00,0x00 },  /* 11 */
+  {0x50,0x55,0x55,0x51,0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x54,
+   0x01,0x50,0x51,0x51,0x00,0x55,0x55,0x55,0x05,0x50,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x50,0x54,0x55,0x55,0x55,0x15,0x50,0x55,0x55,0x55,0x55,0x55,0x45,0x55,0x55,0x04,
+   0x55,0x15,0x00,0x40,0x05,0x00,0x55,0x55,0x00,0x50,0x55,0x55,0x50,0x01,0x00,0x00 },  /* 12 */
+  {0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x51,0x00,0x00,0x40,
+   0x55,0x15,0x00,0x40,0x55,0x55,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x14,0x51,0x15,0x55,0x55,0x55,0x55,0x55,0x55,0x44,0x55,0x55,0x51,0x00,0x00,0x04,
+   0x55,0x11,0x00,0x00,0x55,0x55,0x05,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 13 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x11,0x51,0x55,
+   0x55,0x55,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x01,0x00,0x00,0x00,0x40,
+   0x00,0x04,0x55,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,
+   0x55,0x45,0x55,0x51,0x55,0x55,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 14 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x01,0x04,0x00,0x41,0x41,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x50,0x05,0x54,0x55,0x55,0x55,0x01,0x54,0x55,0x55,
+   0x45,0x41,0x55,0x51,0x55,0x55,0x55,0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x45,0x00,0x04,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },  /* 15 */
+  {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 16 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x51,0x05,0x55,0x15,0x51,0x05,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x51,0x05,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x51,0x05,0x55,0x15,
+   0x51,0x05,0x55,0x55,0x55,0x15,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },  /* 17 */
+  {0x55,0x55,0x55,0x55,0x51,0x05,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x01,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x55,0x05 },  /* 18 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x01,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x01,0x00 },  /* 19 */
+  {0x55,0x55,0x55,0x55,0x05,0x04,0x00,0x40,0x55,0x55,0x55,0x55,0x05,0x15,0x00,0x00,
+   0x55,0x55,0x55,0x55,0x05,0x00,0x00,0x00,0x55,0x55,0x55,0x51,0x01,0x00,0x00,0x00,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x10,0x00,0x50,
+   0x55,0x45,0x01,0x00,0x00,0x55,0x55,0x01,0x55,0x55,0x05,0x00,0x55,0x55,0x05,0x00 },  /* 20 */
+  {0x55,0x55,0x15,0x00,0x55,0x55,0x05,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x01,0x00,
+   0x55,0x41,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x11,0x00,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x00,0x00 },  /* 21 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x40,0x15,0x54,0x00,0x45,0x55,0x01,0x00,
+   0x01,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x55,0x01,0x00,0x00,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x05,0x00,0x55,0x55,0x15,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },  /* 22 */
+  {0x55,0x55,0x55,0x55,0x55,0x15,0x14,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x45,0x00,0x00,0x44,0x01,0x00,0x54,0x15,0x00,0x00,0x00,
+   0x55,0x55,0x05,0x00,0x55,0x55,0x05,0x00,0x55,0x55,0x55,0x05,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 23 */
+  {0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x04,0x40,0x54,
+   0x45,0x55,0x55,0x01,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x00,0x55,0x55,0x15,
+   0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x50,0x10,0x50,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x45,0x50,0x11,0x50,0x00,0x00,0x55 },  /* 24 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x05,0x40,0x55,
+   0x55,0x55,0x05,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x01,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x54,
+   0x55,0x55,0x00,0x00,0x40,0x00,0x00,0x00,0x04,0x00,0x54,0x51,0x55,0x54,0x10,0x00 },  /* 25 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 26 */
+  {0x55,0x55,0x55,0x55,0x55,0x05,0x55,0x05,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x05,0x55,0x05,0x55,0x55,0x44,0x44,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x51,0x55,0x55,
+   0x55,0x51,0x55,0x55,0x55,0x50,0x55,0x54,0x55,0x55,0x55,0x55,0x50,0x51,0x55,0x15 },  /* 27 */
+  {0x55,0x55,0x15,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x40,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x00,0x05,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x15,0x55,0x55,0x55,0x01,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 28 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },  /* 29 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0xa5,0x55,0x55,0x55,0x69,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0xa9,0x56,0x96,0x55,0x55,0x55 },  /* 30 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x55,0x55,0x15,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },  /* 31 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x69 },  /* 32 */
+  {0x55,0x55,0x55,0x55,0x55,0x5a,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0xaa,0xaa,0xaa,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x95,
+   0x55,0x55,0x55,0x55,0x95,0x55,0x55,0x55,0x59,0x55,0xa5,0x55,0x55,0x55,0x55,0x69,
+   0x55,0x5a,0x55,0x65,0x55,0x56,0x55,0x55,0x55,0x55,0x65,0x55,0xa5,0x59,0x65,0x59 },  /* 33 */
+  {0x55,0x59,0xa5,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x56,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x66,0x95,0x9a,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0xa9,0x55,0x55,0x55,0x55,0x55,0x55,0x56,0x55,0x55,0x95,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },  /* 34 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x95,0x56,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x56,0x59,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x50,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x45,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },  /* 35 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x50,0x00,0x54,0x55 },  /* 36 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x45,0x00,0x04,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x40,0x01,0x00,0x00,0x00,
+   0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x00,0x55,0x15,0x55,0x15,0x55,0x15,0x55,0x15,
+   0x55,0x15,0x55,0x15,0x55,0x15,0x55,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 37 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x8a,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x00,0x00,0x00 },  /* 38 */
+  {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0xaa,0xaa,0x00 },  /* 39 */
+  {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x0a,0xa0,0xaa,0xaa,0xaa,0x6a,
+   0xa8,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0x2a,0x80,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa },  /* 40 */
+  {0x00,0xa8,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xa8,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0x2a,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x00,0x00,0x00,0xaa,0xaa,0xaa,0xaa },  /* 41 */
+  {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x2a,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa },  /* 42 */
+  {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa },  /* 43 */
+  {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0x02,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0x2a,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },  /* 44 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x00,0x00,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x40,0x00,0x00,0x50,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x50,0x55,0x00,0x00 },  /* 45 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x15,0x00,0x45,0x54,0x05,0x00,0x00,0x00,0x00,0x00,0x50,0x55,0x55,0x55 },  /* 46 */
+  {0x45,0x45,0x15,0x55,0x55,0x55,0x55,0x55,0x55,0x41,0x55,0x00,0x55,0x55,0x05,0x00,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x00,0x00,0x50,0x55,0x55,0x05,0x00,0x00,0x00,0x00,0x00,0x50,0x55,0x55,0x15 },  /* 47 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x00,0x50,0x55,0x55,0x55,0x55,
+   0x55,0x15,0x00,0x00,0x50,0x00,0x00,0x40,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x02,
+   0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x05,0x50,0x50,
+   0x55,0x55,0x55,0x45,0x55,0x55,0x05,0x50,0x55,0x51,0x55,0x55,0x55,0x55,0x55,0x15 },  /* 48 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x01,0x40,0x41,0x01,0x00,0x00,
+   0x15,0x55,0x55,0x04,0x55,0x55,0x05,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x54,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x04,0x14,0x54,0x05,
+   0x11,0x00,0x00,0x00,0x00,0x00,0x40,0x55,0x55,0x55,0x55,0x50,0x55,0x05,0x00,0x00 },  /* 49 */
+  {0x54,0x15,0x54,0x15,0x54,0x15,0x00,0x00,0x55,0x15,0x55,0x15,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x51,0x54,0x01,0x55,0x55,0x05,0x00 },  /* 50 */
+  {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 51 */
+  {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 52 */
+  {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x0a,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 53 */
+  {0x55,0x15,0x00,0x00,0x40,0x55,0x00,0x44,0x55,0x55,0x55,0x55,0x55,0x15,0x55,0x11,
+   0x45,0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x15,0x00,0x00,0x00,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },  /* 54 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x55 },  /* 55 */
+  {0x00,0x00,0x00,0x00,0xaa,0xaa,0x0a,0x00,0x00,0x00,0x00,0x00,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0x2a,0xaa,0xaa,0xaa,0xaa,0x2a,0xaa,0x00,0x55,0x51,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x01 },  /* 56 */
+  {0xa8,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x56,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,
+   0x50,0x55,0x50,0x55,0x50,0x55,0x50,0x01,0xaa,0x2a,0x55,0x15,0x00,0x00,0x00,0x05 },  /* 57 */
+  {0x55,0x55,0x55,0x54,0x55,0x55,0x55,0x55,0x55,0x15,0x55,0x55,0x55,0x55,0x15,0x45,
+   0x55,0x55,0x55,0x05,0x55,0x55,0x55,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x00 },  /* 58 */
+  {0x15,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x40,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x15,0x55,0x55,0x55,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x01 },  /* 59 */
+  {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x01,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x01,0x00,0x00,0x00,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x00 },  /* 60 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x54,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x15,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x00,0x00,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x45,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x00,0x55,0x55,0x55,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 61 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x55,0x55,0x05,0x00,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00 },  /* 62 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x40,0x55,0x55,0x15,0x55,
+   0x55,0x55,0x15,0x55,0x15,0x45,0x55,0x55,0x45,0x55,0x55,0x55,0x45,0x55,0x45,0x01,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 63 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x00,
+   0x55,0x55,0x55,0x55,0x55,0x05,0x00,0x00,0x55,0x55,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x55,0x45,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x51,0x55,0x15,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 64 */
+  {0x55,0x05,0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x45,0x01,0x41,
+   0x55,0x55,0x55,0x55,0x55,0x45,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x40,0x55,0x55,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x55,0x15,0x05,0x40,0x55 },  /* 65 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x40,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x55,
+   0x55,0x55,0x55,0x55,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },  /* 66 */
+  {0x01,0x00,0x00,0x00,0x55,0x54,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x00,0x00,
+   0x55,0x55,0x01,0x00,0x55,0x55,0x01,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x01,0x40,0x55,0x55,0x15,0x00,0x00 },  /* 67 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x54,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x05,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x05,0x00,0x54,0x01,0x00,0x00,0x54,0x55,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 68 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x00,0x00,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x50,0x55 },  /* 69 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x55,0x55,0x05,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 70 */
+  {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x04,0x05,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 71 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x55,0x55,0x55,0x55,
+   0x55,0x05,0x00,0x00,0x54,0x55,0x05,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x55,
+   0x05,0x50,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x00 },  /* 72 */
+  {0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,
+   0x00,0x40,0x55,0x05,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x14,0x04,0x00,0x00,
+   0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x40,0x41,0x55,
+   0x05,0x00,0x00,0x04,0x55,0x55,0x55,0x55,0x55,0x55,0x01,0x00,0x55,0x55,0x05,0x00 },  /* 73 */
+  {0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x01,0x00,0x50,0x55,0x55,
+   0x55,0x55,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x15,0x00,0x00,
+   0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x00,0x40,
+   0x55,0x55,0x01,0x14,0x55,0x55,0x55,0x55,0x54,0x55,0x55,0x55,0x55,0x01,0x00,0x00 },  /* 74 */
+  {0x55,0x55,0x55,0x55,0x45,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x50,0x04,0x55,0x05,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x55,0x15,0x51,0x45,0x55,0x55,0x55,0x45,0x55,0x55,0x05,0x00,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x15,0x00,0x00,0x00,0x55,0x55,0x05,0x00 },  /* 75 */
+  {0x50,0x54,0x55,0x41,0x41,0x55,0x55,0x55,0x55,0x55,0x51,0x55,0x51,0x54,0x05,0x54,
+   0x54,0x41,0x41,0x05,0x01,0x40,0x00,0x54,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 76 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,
+   0x05,0x44,0x55,0x55,0x55,0x55,0x55,0x44,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x44,0x15,
+   0x04,0x55,0x00,0x00,0x55,0x55,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 77 */
+  {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x00,0x55,0x10,
+   0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 78 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x40,0x11,
+   0x54,0x01,0x00,0x00,0x55,0x55,0x05,0x00,0x55,0x55,0x55,0x01,0x00,0x00,0x00,0x00,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x51,0x00,0x10,0x05,0x00,
+   0x55,0x55,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 79 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x05,0x10,0x00,0x00,0x55,0x55,0x55,0x55,
+   0x55,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 80 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x00,0x41,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x00,0x40 },  /* 81 */
+  {0x55,0x15,0x04,0x55,0x55,0x14,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x45,0x01,0x44,
+   0x15,0x15,0x00,0x00,0x55,0x55,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x50,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x55,0x54,0x01,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 82 */
+  {0x01,0x00,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x14,0x40,
+   0x55,0x15,0x00,0x00,0x01,0x40,0x01,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x05,0x00,0x00,0x40,0x50,0x55,0x15,0x00,0x00,0x00,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x01,0x00 },  /* 83 */
+  {0x55,0x55,0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x10,
+   0x55,0x05,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x01,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x01,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 84 */
+  {0x55,0x15,0x45,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x01,0x00,0x00,0x00,
+   0x00,0x10,0x00,0x00,0x55,0x55,0x05,0x00,0x55,0x45,0x51,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x15,0x40,0x11,0x01,0x00,0x55,0x55,0x05,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 85 */
+  {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x55,0x15,0x54,0x01,0x00 },  /* 86 */
+  {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x00,0x00,0x40 },  /* 87 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 88 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x55,0x01,0x00,0x00,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },  /* 89 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 90 */
+  {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x00,0x00 },  /* 91 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 92 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 93 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x01,0x00,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x55,0x55,0x05,0x50,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,
+   0x55,0x55,0x05,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x00,0x04,0x00,0x00 },  /* 94 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x40,0x55,0x55,
+   0x55,0x05,0x00,0x00,0x55,0x55,0x45,0x55,0x45,0x55,0x55,0x55,0x55,0x55,0x00,0x54,
+   0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 95 */
+  {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 96 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x15,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x00,0x00,0x40,0x55,0x55,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0x00,0x00,0x00,0x0a,0x00,0x00,0x00 },  /* 97 */
+  {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x00,0x00 },  /* 98 */
+  {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 99 */
+  {0xaa,0xaa,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 100 */
+  {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0xa8,0xaa,0x28 },  /* 101 */
+  {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x2a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x2a,0x00,0x00,0x00,0x00,0xaa,0x00,0x00,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa },  /* 102 */
+  {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x00 },  /* 103 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x55,0x55,0x55,0x01,
+   0x55,0x55,0x01,0x00,0x55,0x55,0x05,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 104 */
+  {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 105 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x00,0x00 },  /* 106 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x54,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x50,0x55,0x15,0x00,0x00,0x00,
+   0x40,0x01,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x50,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x00,0x00,0x00,0x00 },  /* 107 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x05,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x00 },  /* 108 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x01,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 109 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x51,0x10,0x14,0x54,0x51,0x55,0x55,0x45,0x54,
+   0x55,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },  /* 110 */
+  {0x55,0x45,0x15,0x54,0x55,0x51,0x55,0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x45,0x15,
+   0x55,0x11,0x50,0x55,0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },  /* 111 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },  /* 112 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },  /* 113 */
+  {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x15,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0x55,0x51,0x55,0x55,
+   0x55,0x54,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 114 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 115 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x01,0x00,0x40,0x55,0x05,
+   0x55,0x55,0x05,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 116 */
+  {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x00,0x00,0x00,0x00,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x55,0x55,0x05,0x40 },  /* 117 */
+  {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x15,0x55,0x14,0x55,0x55,0x55,0x15 },  /* 118 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x41,0x55,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 119 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x00,0x40,0x00,0x55,0x55,0x05,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 120 */
+  {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x01,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 121 */
+  {0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 122 */
+  {0x55,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x14,0x41,0x54,0x55,0x15,0x55,0x44,0x00,
+   0x10,0x40,0x44,0x54,0x14,0x41,0x44,0x44,0x14,0x41,0x15,0x55,0x15,0x55,0x54,0x11,
+   0x55,0x55,0x45,0x55,0x55,0x55,0x55,0x00,0x54,0x54,0x45,0x55,0x55,0x55,0x55,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00 },  /* 123 */
+  {0x55,0x56,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x55,0x55,0x55,0x15,0x54,0x55,0x55,0x55,
+   0x54,0x55,0x55,0x95,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x00,0x00 },  /* 124 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x65,0xa9,0xaa,0x6a,0x55,0x55,0x55,0x55,0x05,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x55,0x55,0x55,0x55,0x55,0x55 },  /* 125 */
+  {0x2a,0x00,0x00,0x00,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x00,
+   0xaa,0xaa,0x02,0x00,0x0a,0x00,0x00,0x00,0xaa,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 126 */
+  {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x56,0x55,0x55,0xa9,0xaa,0x9a,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xa6,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0x55,0x55,0x55,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0x6a,0x95,0xaa,0x55,0x55,0x55,0xaa,0xaa,0xaa,0xaa,0x56,0x56,0xaa,0xaa },  /* 127 */
+  {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x6a,
+   0xa6,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x96 },  /* 128 */
+  {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x5a,
+   0x55,0x55,0x95,0x6a,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x55,0x55,0x55,0x55,0x65,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x69,0x55,0x55,0x55,0x56,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x95,0xaa },  /* 129 */
+  {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0x5a,0x55,0x56,0x6a,0xa9,0x00,0xa8,0x55,0x55,0x95,0x02,0x55,0xaa,0xaa,0x02 },  /* 130 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x00,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x01,0x00,0xaa,0xaa,0xaa,0x00,0x02,0x00,0x00,0x00 },  /* 131 */
+  {0x55,0x55,0x55,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x00,0x00,0x55,0x55,0x05,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x05,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 132 */
+  {0x55,0x55,0x55,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x6a,0xaa,
+   0xaa,0x9a,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa },  /* 133 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x55,0x55,0x55,0x05,0xaa,0x02,0xaa,0x02,
+   0xaa,0x2a,0x00,0x00,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x02,0xaa,0xaa,0x2a,0x00,
+   0xaa,0x0a,0x00,0x00,0xaa,0xaa,0x0a,0x00,0xaa,0xaa,0x00,0x00,0xaa,0x2a,0x00,0x00 },  /* 134 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x15,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x05,0x00 },  /* 135 */
+  {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 136 */
+  {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x02,0x00,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa },  /* 137 */
+  {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x0a,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa },  /* 138 */
+  {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x0a,0x00,0x00,0x00,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa },  /* 139 */
+  {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 140 */
+  {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 141 */
+  {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+   0xaa,0xaa,0x2a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },  /* 142 */
+  {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+   0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05 }  /* 143 */
+};
+
+
+
+/*************************************************
+*        Find screen width of a character        *
+*************************************************/
+
+/* Argument:  a character code point
+   Returns:   0 if the character is not displayable, 1 or 2 otherwise
+*/
+
+usint
+ch_width(usint c)
+{
+usint b;
+if (c > 0x10ffff) return 0;
+b = ch_width_rows[ch_width_planes[c >> 16]][(c >> 8) & 0xff];
+return (ch_width_blocks[b][(c & 0xff) >> 2] >> ((c & 3) * 2)) & 3;
+}
+
+/* End of chdisplay.c */
@@ -2,10 +2,10 @@
 *       The E text editor - 3rd incarnation      *
 *************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2022 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: December 2022 */
+/* This file last modified: October 2026 */
 
 /* This header file contains a list of functions for obeying E commands. They
 have to be global so that they can be inserted into a vector. */
@@ -74,6 +74,7 @@ extern int e_plllr(cmdstr *);
 extern int e_proc(cmdstr *);
 extern int e_prompt(cmdstr *);
 extern int e_readonly(cmdstr *);
+extern int e_redo(cmdstr *);
 extern int e_refresh(cmdstr *);
 extern int e_renumber(cmdstr *);
 extern int e_repeat(cmdstr *);
@@ -89,6 +90,7 @@ extern int e_title(cmdstr *);
 extern int e_topline(cmdstr *);
 extern int e_ucl(cmdstr *);
 extern int e_undelete(cmdstr *);
+extern int e_undo(cmdstr *);
 extern int e_unformat(cmdstr *);
 extern int e_verify(cmdstr *);
 extern int e_w(cmdstr *);
@@ -2,10 +2,10 @@
 *       The E text editor - 3rd incarnation      *
 *************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2022 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: December 2022 */
+/* This file last modified: October 2026 */
 
 
 /* This file contains debugging code, so exclude it from coverage testing. */
@@ -19,6 +19,23 @@
 *           Display debugging output             *
 *************************************************/
 
+/* The debug file is called NEdebug, and is opened when first needed. */
+
+static void
+debug_openfile(void)
+{
+if (debug_file == NULL)
+  {
+  debug_file = fopen("NEdebug", "w");
+  if (debug_file == NULL)
+    {
+    printf("\n**** Can't open debug file NEdebug (%s) - aborting ****\n\n",
+      strerror(errno));
+    exit(99);
+    }
+  }
+}
+
 /* Made global so it can be called from anywhere. In screen mode it outputs to
 a file called NEdebug; otherwise it writes to stdout. */
 
@@ -29,16 +46,7 @@ va_list ap;
 va_start(ap, format);
 if (main_screenmode)
   {
-  if (debug_file == NULL)
-    {
-    debug_file = fopen("NEdebug", "w");
-    if (debug_file == NULL)
-      {
-      printf("\n**** Can't open debug file NEdebug (%s) - aborting ****\n\n",
-        strerror(errno));
-      exit(99);
-      }
-    }
+  debug_openfile();
   vfprintf(debug_file, format, ap);
   fflush(debug_file);
   }
@@ -68,6 +76,57 @@ debug_printf("-------------------------------------\n");
 }
 
 
+/*************************************************
+*              Show the statistics               *
+*************************************************/
+
+static void
+debug_fileprintf(const char *format, ...)
+{
+va_list ap;
+va_start(ap, format);
+vfprintf(debug_file, format, ap);
+va_end(ap);
+}
+
+/* This is used by SHOW STATS, and at exit if -stats was given, when the output
+always goes to the debug file, whatever the mode.
+
+Argument:  TRUE to write to the debug file, FALSE for error_printf()
+Returns:   nothing
+*/
+
+void
+debug_stats(BOOL tofile)
+{
+void (*print)(const char *, ...) = error_printf;
+statsstr *s = &main_stats;
+
+if (tofile)
+  {
+  debug_openfile();
+  print = debug_fileprintf;
+  }
+
+print("Commands obeyed:      %10lu\n", s->commands);
+print("Lines searched:       %10lu\n", s->se_lines);
+print("Regex compiles:       %10lu\n", s->re_compiles);
+print("Regex matches:        %10lu\n", s->re_matches);
+print("Store gets:           %10lu  free queue steps %lu\n", s->store_gets,
+  s->store_getwalk);
+print("Store frees:          %10lu  free queue steps %lu\n", s->store_frees,
+  s->store_freewalk);
+print("File bytes read:      %10lu\n", s->file_read);
+print("File bytes written:   %10lu\n", s->file_written);
+print("Screen lines drawn:   %10lu\n", s->screen_lines);
+print("Screen bytes written: %10lu\n", s->screen_bytes);
+print("Processor time:       %10.2fs\n", (double)clock()/CLOCKS_PER_SEC);
+print("Elapsed time:         %10.0fs\n", difftime(time(NULL), s->start));
+if (tofile) fflush(debug_file);
+}
+
+
+
 /*************************************************
 *            Write to a crash log file           *
 *************************************************/
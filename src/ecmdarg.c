@@ -2,10 +2,10 @@
 *       The E text editor - 3rd incarnation      *
 *************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2023 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: February 2023 */
+/* This file last modified: October 2026 */
 
 
 /* This file contains code for reading the arguments of commands or infering
@@ -811,10 +811,23 @@ else if (Ustrcmp(cmd_word, "newcommentstyle") == 0)
   cmd->misc = set_newcommentstyle;
   }
 
+else if (Ustrcmp(cmd_word, "undolimit") == 0)
+  {
+  int n = cmd_readnumber();
+  if (n >= 0)
+    {
+    cmd->misc = set_undolimit;
+    cmd->arg1.value = n;
+    cmd->flags |= cmdf_arg1;
+    }
+  else error_moan_decode(13, "Number");
+  }
+
 else   /* unknown SET option */
   {
   error_moan_decode(13, "\"autovscroll\", \"autovmousescroll\", "
-    "\"splitscrollrow\", \"oldcommentstyle\", or \"newcommentstyle\"");
+    "\"splitscrollrow\", \"oldcommentstyle\", \"newcommentstyle\", "
+    "or \"undolimit\"");
   }
 }
 
@@ -841,10 +854,12 @@ else if (Ustrcmp(cmd_word, "commands") == 0)    cmd->misc = show_commands;
 else if (Ustrcmp(cmd_word, "wordchars") == 0)   cmd->misc = show_wordchars;
 else if (Ustrcmp(cmd_word, "settings") == 0)    cmd->misc = show_settings;
 else if (Ustrcmp(cmd_word, "allsettings") == 0) cmd->misc = show_allsettings;
+else if (Ustrcmp(cmd_word, "stats") == 0)       cmd->misc = show_stats;
 else
   {
   error_moan_decode(13, "keys, ckeys, fkeys, xkeys, keystrings, keyactions, "
-    "buffers, commands,\n   wordchars, wordcount, [all]settings, or version");
+    "buffers, commands,\n   wordchars, wordcount, [all]settings, stats, or "
+    "version");
   }
 }
 
@@ -861,7 +876,7 @@ int c;
 uschar *eptr = cmd_ptr + Ustrlen(cmd_ptr);
 mac_skipspaces(cmd_ptr);
 GETCHARINC(c, cmd_ptr, eptr);
-if ((ch_displayable[c/8] & (1<<(c%8))) != 0) error_moan_decode(54, c);
+if (ch_width(c) != 1) error_moan_decode(54, c);
 else cmd->arg1.value = c;
 }
 
@@ -1093,6 +1108,7 @@ cmd_Cproc cmd_Cproclist[] = {
   c_onoff,      /* prompt */
   noargs,       /* quit */
   c_onoff,      /* readonly */
+  noargs,       /* redo */
   noargs,       /* refresh */
   noargs,       /* renumber */
   c_repeat,     /* repeat */
@@ -1110,6 +1126,7 @@ cmd_Cproc cmd_Cproclist[] = {
   noargs,       /* topline */
   noargs,       /* ucl */
   noargs,       /* undelete */
+  noargs,       /* undo */
   noargs,       /* unformat */
   c_unless,     /* unless */
   c_until,      /* until */
@@ -1219,6 +1236,7 @@ cmd_Eproc cmd_Eproclist[] = {
   e_prompt,     /* prompt */
   e_stop,       /* quit */
   e_readonly,   /* readonly */
+  e_redo,       /* redo */
   e_refresh,    /* refresh */
   e_renumber,   /* renumber */
   e_repeat,     /* repeat */
@@ -1236,6 +1254,7 @@ cmd_Eproc cmd_Eproclist[] = {
   e_topline,    /* topline */
   e_ucl,        /* ucl */
   e_undelete,   /* undelete */
+  e_undo,       /* undo */
   e_unformat,   /* unformat */
   e_if,         /* unless */
   e_while,      /* until */
@@ -2,10 +2,10 @@
 *       The E text editor - 3rd incarnation      *
 *************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2024 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: February 2024 */
+/* This file last modified: October 2026 */
 
 
 /* This file contains code for the top-level handling of a command line, and
@@ -109,6 +109,7 @@ uschar *cmd_list[] = {
   US"prompt",
   US"quit",
   US"readonly",
+  US"redo",
   US"refresh",
   US"renumber",
   US"repeat",
@@ -126,6 +127,7 @@ uschar *cmd_list[] = {
   US"topline",
   US"ucl",
   US"undelete",
+  US"undo",
   US"unformat",
   US"unless",
   US"until",
@@ -234,6 +236,7 @@ static uschar cmd_readonly[] = {
    TRUE, /* prompt */
    TRUE, /* quit */
    TRUE, /* readonly */
+  FALSE, /* redo */
    TRUE, /* refresh */
   FALSE, /* renumber */
    TRUE, /* repeat */
@@ -251,6 +254,7 @@ static uschar cmd_readonly[] = {
    TRUE, /* topline */
   FALSE, /* ucl */
   FALSE, /* undelete */
+  FALSE, /* undo */
   FALSE, /* unformat */
    TRUE, /* unless */
    TRUE, /* until */
@@ -372,6 +376,7 @@ static uschar cmd_passive[] = {
    TRUE, /* prompt */
    TRUE, /* quit */
    TRUE, /* readonly */
+  FALSE, /* redo */
    TRUE, /* refresh */
   FALSE, /* renumber */
    TRUE, /* repeat */
@@ -389,6 +394,7 @@ static uschar cmd_passive[] = {
   FALSE, /* topline */
   FALSE, /* ucl */
   FALSE, /* undelete */
+  FALSE, /* undo */
   FALSE, /* unformat */
    TRUE, /* unless */
    TRUE, /* until */
@@ -419,9 +425,149 @@ command words. Keep this in step with the string just below. */
    TRUE  /* procedure */
 };
 
+/* Indicators for commands whose only effects are on settings that are saved
+in the cache of an initialization file (see obey_init()). Procedure calls and
+bracketed sequences are included, because the commands they obey are checked
+individually. */
+
+static uschar cmd_cacheable[] = {
+  FALSE, /* a */
+  FALSE, /* abandon */
+  FALSE, /* align */
+  FALSE, /* alignp */
+  FALSE, /* attn */
+   TRUE, /* autoalign */
+  FALSE, /* b */
+  FALSE, /* back */
+  FALSE, /* backregion */
+   TRUE, /* backup */
+  FALSE, /* beginpar */
+  FALSE, /* bf */
+  FALSE, /* break */
+  FALSE, /* buffer */
+  FALSE, /* c */
+   TRUE, /* casematch */
+  FALSE, /* cbuffer */
+  FALSE, /* cdbuffer */
+  FALSE, /* center */
+  FALSE, /* centre */
+  FALSE, /* cl */
+  FALSE, /* closeback */
+  FALSE, /* closeup */
+  FALSE, /* comment */
+  FALSE, /* copy */
+  FALSE, /* cproc */
+  FALSE, /* csd */
+  FALSE, /* csu */
+  FALSE, /* cut */
+   TRUE, /* cutstyle */
+  FALSE, /* dbuffer */
+  FALSE, /* dcut */
+  FALSE, /* debug */
+  FALSE, /* detrail */
+  FALSE, /* df */
+  FALSE, /* dleft */
+  FALSE, /* dline */
+  FALSE, /* dmarked */
+  FALSE, /* drest */
+  FALSE, /* dright */
+  FALSE, /* dta */
+  FALSE, /* dtb */
+  FALSE, /* dtwl */
+  FALSE, /* dtwr */
+  FALSE, /* e */
+   TRUE, /* eightbit */
+  FALSE, /* endpar */
+  FALSE, /* f */
+   TRUE, /* fkeystring */
+   TRUE, /* fks */
+  FALSE, /* format */
+  FALSE, /* front */
+  FALSE, /* ga */
+  FALSE, /* gb */
+  FALSE, /* ge */
+  FALSE, /* help */
+  FALSE, /* i */
+  FALSE, /* icurrent */
+  FALSE, /* if */
+  FALSE, /* iline */
+  FALSE, /* ispace */
+   TRUE, /* key */
+  FALSE, /* lcl */
+  FALSE, /* load */
+  FALSE, /* loop */
+  FALSE, /* m */
+  FALSE, /* makebuffer */
+  FALSE, /* mark */
+  FALSE, /* mouse */
+  FALSE, /* n */
+  FALSE, /* name */
+  FALSE, /* ne */
+  FALSE, /* newbuffer */
+   TRUE, /* overstrike */
+  FALSE, /* p */
+  FALSE, /* pa */
+  FALSE, /* paste */
+  FALSE, /* pb */
+  FALSE, /* pbuffer */
+  FALSE, /* pll */
+  FALSE, /* plr */
+   TRUE, /* proc */
+  FALSE, /* prompt */
+  FALSE, /* quit */
+   TRUE, /* readonly */
+  FALSE, /* redo */
+  FALSE, /* refresh */
+  FALSE, /* renumber */
+  FALSE, /* repeat */
+   TRUE, /* rmargin */
+  FALSE, /* sa */
+  FALSE, /* save */
+  FALSE, /* sb */
+   TRUE, /* set */
+  FALSE, /* show */
+  FALSE, /* stop */
+   TRUE, /* subchar */
+  FALSE, /* t */
+  FALSE, /* title */
+  FALSE, /* tl */
+  FALSE, /* topline */
+  FALSE, /* ucl */
+  FALSE, /* undelete */
+  FALSE, /* undo */
+  FALSE, /* unformat */
+  FALSE, /* unless */
+  FALSE, /* until */
+  FALSE, /* uteof */
+  FALSE, /* verify */
+  FALSE, /* w */
+   TRUE, /* warn */
+  FALSE, /* while */
+   TRUE, /* wide */
+   TRUE, /* word */
+  FALSE, /* write */
+
+/* The single-character special commands have ids that follow on from the
+command words. Keep this in step with the string just below. */
+
+  FALSE, /* * */
+  FALSE, /* ? */
+  FALSE, /* > */
+  FALSE, /* < */
+  FALSE, /* # */
+  FALSE, /* $ */
+  FALSE, /* % */
+  FALSE, /* ~ */
+
+/* Finally, bracketed sequences and procedures use values that follow. */
+
+   TRUE, /* brackets */
+   TRUE  /* procedure */
+};
+
 /* Single-character special commands; we have star at the front of the string
 to allocate it an id, though it is never matched via this string. If ever this
-is changed, keep the readonly and passive tables above in step. */
+is changed, keep the readonly, passive, and cacheable tables above in step. */
 
 static uschar *xcmdlist = US"*?><#$%~";
 
@@ -438,6 +584,32 @@ static cmdstr *CompileSequence(void);
 
 
 
+/*************************************************
+*      Get a command block for compiling         *
+*************************************************/
+
+/* The readonly, passive, cacheable, and single-character properties of a
+command are looked up once here and cached in the block's xflags, so that
+obeying a compiled command (perhaps many times in a loop) does not have to
+consult the tables.
+
+Argument:  the command id
+Returns:   the new command block
+*/
+
+static cmdstr *
+GetCmd(int id)
+{
+cmdstr *yield = cmd_getcmdstr(id);
+if (cmd_readonly[id]) yield->xflags |= cmdx_readonly;
+if (cmd_passive[id]) yield->xflags |= cmdx_passive;
+if (cmd_cacheable[id]) yield->xflags |= cmdx_cacheable;
+if (id >= cmd_specialbase && id < cmd_specialend) yield->xflags |= cmdx_once;
+return yield;
+}
+
+
+
 /*************************************************
 *         Compile "system" command               *
 *************************************************/
@@ -452,7 +624,7 @@ static cmdstr *
 CompileSysLine(void)
 {
 stringstr *string = store_Xget(sizeof(stringstr));
-cmdstr *yield = cmd_getcmdstr(cmd_specialbase);   /* "*" is the first special */
+cmdstr *yield = GetCmd(cmd_specialbase);   /* "*" is the first special */
 
 yield->flags |= cmdf_arg1 + cmdf_arg1F;
 
@@ -527,7 +699,7 @@ if (cmd_word[0] == 0)
 
   if (*cmd_ptr == '(')
     {
-    cmdstr *yield = cmd_getcmdstr(cmd_sequence);
+    cmdstr *yield = GetCmd(cmd_sequence);
     yield->count = count;
     cmd_ptr++;
 
@@ -550,7 +722,7 @@ if (cmd_word[0] == 0)
     stringstr *name;
     if (cmd_readprocname(&name))
       {
-      cmdstr *yield = cmd_getcmdstr(cmd_obeyproc);
+      cmdstr *yield = GetCmd(cmd_obeyproc);
       yield->count = count;
       yield->arg1.string = name;
       yield->flags |= cmdf_arg1 | cmdf_arg1F;
@@ -593,7 +765,7 @@ if (cmd_word[0] == 0)
       }
     else
       {
-      cmdstr *yield = cmd_getcmdstr(cmd_specialbase + p - xcmdlist);
+      cmdstr *yield = GetCmd(cmd_specialbase + p - xcmdlist);
       yield->count = count;
       yield->misc = c;
       if (*cmd_ptr == '^') cmd_ptr++;
@@ -630,7 +802,7 @@ for quoting for spaces. */
 
 if (found >= 0)
   {
-  cmdstr *yield = cmd_getcmdstr(found);
+  cmdstr *yield = GetCmd(found);
   yield->count = count;
   if (*cmd_ptr == '^') cmd_ptr++;
   (cmd_Cproclist[found])(yield);
@@ -766,7 +938,8 @@ if (++cmd_bracount > 300)
 
 /* For each command, obey it <count> times, provided there are no errors.
 Single-char commands take care of the count themselves, so are called only
-once. They are identified by high-valued ids. */
+once. Such properties, and the function that obeys the command, are cached in
+the command block when it is compiled, so there are no table lookups here. */
 
 while (cmd != NULL && yield == done_continue)
   {
@@ -774,7 +947,7 @@ while (cmd != NULL && yield == done_continue)
 
   /* Check for disallowed commands in readonly mode. */
 
-  if (main_readonly && !cmd_readonly[(usint)(cmd->id)])
+  if (main_readonly && (cmd->xflags & cmdx_readonly) == 0)
     {
     uschar *cmdname;
     uschar temp[4];
@@ -806,12 +979,12 @@ while (cmd != NULL && yield == done_continue)
     }
 
   /* OK the command is permitted. Remember if any non-passive command is
-  obeyed. Then get on with it. */
+  obeyed, and if any command is obeyed whose effects could not be saved in the
+  cache of an initialization file. Then get on with it. */
 
-  passive_commands &= cmd_passive[(usint)(cmd->id)];
-  count =
-    ((int)(cmd->id) >= cmd_specialbase && (int)(cmd->id) < cmd_specialend)?
-      1 : cmd->count;
+  passive_commands &= (cmd->xflags & cmdx_passive) != 0;
+  init_cacheable &= (cmd->xflags & cmdx_cacheable) != 0;
+  count = ((cmd->xflags & cmdx_once) != 0)? 1 : cmd->count;
 
   while (count-- > 0)
     {
@@ -822,7 +995,8 @@ while (cmd != NULL && yield == done_continue)
     message window in screen mode. */
 
     main_leave_message = FALSE;
-    yield = (cmd_Eproclist[(usint)(cmd->id)])(cmd);
+    main_stats.commands++;
+    yield = (cmd->proc)(cmd);
 
     /* Commands that generate output (e_g. SHOW) return done_wait; in screen
     mode, if there are more commands to follow on the line, we take a pause
@@ -885,7 +1059,9 @@ return cmd_obeyline(cmd->arg1.cmds);
 *               Handle command line              *
 *************************************************/
 
-/* The command line may be in fixed store, and so is not freed.
+/* The command line may be in fixed store, and so is not freed. This function
+is called recursively by the c and cbuffer commands; the interrupt check timer
+runs while the outermost call is active.
 
 Argument:   pointer to command line
 Returns:    one of the done_xxx values
@@ -894,10 +1070,17 @@ Returns:    one of the done_xxx values
 int
 cmd_obey(uschar *cmdline)
 {
+static int depth = 0;
 int yield = done_error;
 cmdstr *compiled;
 
-main_cicount = 0;
+/* Commands may need the whole of any buffer, so finish reading any files
+that are still being loaded. */
+
+if (main_loading) file_loadrest(NULL);
+
+if (depth++ == 0) sys_citimer(TRUE);
+undo_begin(FALSE);
 compiled = CompileCmdLine(cmdline);
 
 /* Save the command line, whether or not it compiled correctly, unless it is
@@ -929,6 +1112,7 @@ if (!cmd_faildecode)
   cmd_freeblock((cmdblock *)compiled);
   }
 
+if (--depth == 0) sys_citimer(FALSE);
 return yield;
 }
 
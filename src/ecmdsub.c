@@ -2,10 +2,10 @@
 *       The E text editor - 3rd incarnation      *
 *************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2022 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: December 2022 */
+/* This file last modified: October 2026 */
 
 
 /* This file contains code for command-processing functions */
@@ -145,16 +145,30 @@ int cmd_readUstring(stringstr **p) { return xreadstring(p, ';'); }
 *        Get a command control block             *
 *************************************************/
 
-/* Argument is the command id */
+/* Each block is given a unique serial number. Commands that remember their
+arguments for re-use (F, A/B/E, GA/GB/GE) use it to avoid re-copying the
+arguments each time the same compiled command is obeyed, for example in a loop.
+The execution function is set from the table of such functions, so that
+dispatching need not index the table each time.
+
+Argument:  the command id
+Returns:   the new block
+*/
 
 cmdstr *
 cmd_getcmdstr(int id)
 {
+static usint serial = 0;
 cmdstr *yield = store_Xget(sizeof(cmdstr));
 yield->flags = yield->misc = yield->ptype1 = yield->ptype2 = 0;
+yield->xflags = 0;
+yield->bindgen = 0;
 yield->next = NULL;
 yield->type = cb_cmtype;
 yield->id = id;
+yield->proc = cmd_Eproclist[id];
+if (++serial == 0) serial = 1;     /* Zero is reserved for "none" */
+yield->serial = serial;
 return yield;
 }
 
@@ -312,6 +326,264 @@ store_free(cb);
 
 
 
+/*************************************************
+*       Save and load a control block            *
+*************************************************/
+
+/* These functions write a control block, together with any attached blocks,
+to a cache file, and read it back again. They are used for procedures in the
+cache of an initialization file. A compiled regular expression is not saved;
+when the block is loaded, it is left to be compiled when it is first used, in
+the same way as when the direction of a search changes. A procedure call's
+binding to its procedure is not saved either. */
+
+void
+cmd_saveblock(FILE *f, cmdblock *cb)
+{
+if (cb == NULL)
+  {
+  sys_cacheputnumber(f, 0);
+  return;
+  }
+
+sys_cacheputnumber(f, cb->type);
+switch (cb->type)
+  {
+  case cb_sttype:
+    {
+    stringstr *s = (stringstr *)cb;
+    sys_cacheputnumber(f, s->delim);
+    sys_cacheputnumber(f, s->hexed);
+    sys_cacheputstring(f, s->text);
+    }
+  break;
+
+  case cb_setype:
+    {
+    sestr *s = (sestr *)cb;
+    sys_cacheputnumber(f, s->count);
+    sys_cacheputnumber(f, s->flags);
+    sys_cacheputnumber(f, s->windowleft);
+    sys_cacheputnumber(f, s->windowright);
+    cmd_saveblock(f, (cmdblock *)(s->left.se));
+    cmd_saveblock(f, (cmdblock *)(s->right.se));
+    }
+  break;
+
+  case cb_qstype:
+    {
+    qsstr *q = (qsstr *)cb;
+    sys_cacheputnumber(f, q->count);
+    sys_cacheputnumber(f, q->flags);
+    sys_cacheputnumber(f, q->windowleft);
+    sys_cacheputnumber(f, q->windowright);
+    sys_cacheputnumber(f, q->length);
+    sys_cacheputstring(f, q->text);
+    if (q->hexed == NULL) sys_cacheputnumber(f, -1); else
+      {
+      sys_cacheputnumber(f, q->length/2);
+      fwrite(q->hexed, 1, q->length/2, f);
+      }
+    fwrite(q->map, 1, sizeof(q->map), f);
+    }
+  break;
+
+  case cb_cmtype:
+    {
+    cmdstr *cmd = (cmdstr *)cb;
+    sys_cacheputnumber(f, cmd->id);
+    sys_cacheputnumber(f, cmd->flags);
+    sys_cacheputnumber(f, cmd->misc);
+    sys_cacheputnumber(f, cmd->ptype1);
+    sys_cacheputnumber(f, cmd->ptype2);
+    sys_cacheputnumber(f, cmd->arg1type);
+    sys_cacheputnumber(f, cmd->arg2type);
+    sys_cacheputnumber(f, cmd->xflags);
+    sys_cacheputnumber(f, cmd->count);
+    if ((cmd->flags & cmdf_arg1F) != 0)
+      cmd_saveblock(f, (cmdblock *)cmd->arg1.block);
+    else sys_cacheputnumber(f, cmd->arg1.value);
+    if ((cmd->flags & cmdf_arg2F) != 0)
+      cmd_saveblock(f, (cmdblock *)cmd->arg2.block);
+    else sys_cacheputnumber(f, cmd->arg2.value);
+    cmd_saveblock(f, (cmdblock *)cmd->next);
+    }
+  break;
+
+  case cb_iftype:
+    {
+    ifstr *ifblock = (ifstr *)cb;
+    cmd_saveblock(f, (cmdblock *)ifblock->if_then);
+    cmd_saveblock(f, (cmdblock *)ifblock->if_else);
+    }
+  break;
+
+  case cb_prtype:
+    {
+    procstr *pblock = (procstr *)cb;
+    sys_cacheputstring(f, pblock->name);
+    cmd_saveblock(f, (cmdblock *)pblock->body);
+    }
+  break;
+  }
+}
+
+
+/* Read a string from a cache file into a new piece of store. */
+
+static uschar *
+loadstring(uschar **aptr, uschar *end)
+{
+long int len;
+uschar *s = sys_cachestring(aptr, end, &len);
+return (s == NULL)? NULL : store_copystring2(s, s + len);
+}
+
+
+/* Load a block and its attached blocks. If the data runs out or is not valid,
+whatever has been built is freed.
+
+Arguments:
+  aptr      points to the pointer to the data, which is updated; it is set
+              NULL if the data is not valid
+  end       the end of the data
+
+Returns:    the block, which may validly be NULL
+*/
+
+cmdblock *
+cmd_loadblock(uschar **aptr, uschar *end)
+{
+cmdblock *yield = NULL;
+int type = sys_cachenumber(aptr, end);
+
+switch (type)
+  {
+  case 0:
+  return NULL;
+
+  case cb_sttype:
+    {
+    stringstr *s = store_Xget(sizeof(stringstr));
+    s->type = cb_sttype;
+    s->delim = sys_cachenumber(aptr, end);
+    s->hexed = sys_cachenumber(aptr, end);
+    s->text = loadstring(aptr, end);
+    if (s->text == NULL) *aptr = NULL;
+    yield = (cmdblock *)s;
+    }
+  break;
+
+  case cb_setype:
+    {
+    sestr *s = store_Xget(sizeof(sestr));
+    s->type = cb_setype;
+    s->count = sys_cachenumber(aptr, end);
+    s->flags = sys_cachenumber(aptr, end);
+    s->windowleft = sys_cachenumber(aptr, end);
+    s->windowright = sys_cachenumber(aptr, end);
+    s->left.se = (sestr *)cmd_loadblock(aptr, end);
+    s->right.se = (sestr *)cmd_loadblock(aptr, end);
+    yield = (cmdblock *)s;
+    }
+  break;
+
+  case cb_qstype:
+    {
+    long int len;
+    uschar *s;
+    qsstr *q = store_Xget(sizeof(qsstr));
+    q->type = cb_qstype;
+    q->cre = NULL;
+    q->hexed = NULL;
+    q->count = sys_cachenumber(aptr, end);
+    q->flags = sys_cachenumber(aptr, end);
+    q->windowleft = sys_cachenumber(aptr, end);
+    q->windowright = sys_cachenumber(aptr, end);
+    q->length = sys_cachenumber(aptr, end);
+    q->text = loadstring(aptr, end);
+    s = sys_cachestring(aptr, end, &len);
+    if (s != NULL)
+      {
+      q->hexed = store_Xget(len);
+      memcpy(q->hexed, s, len);
+      }
+    if (*aptr != NULL && *aptr + sizeof(q->map) <= end)
+      {
+      memcpy(q->map, *aptr, sizeof(q->map));
+      *aptr += sizeof(q->map);
+      }
+    else *aptr = NULL;
+    if (q->text == NULL) *aptr = NULL;
+    yield = (cmdblock *)q;
+    }
+  break;
+
+  case cb_cmtype:
+    {
+    int id = sys_cachenumber(aptr, end);
+    cmdstr *cmd;
+
+    /* Named commands are followed by 8 single-character commands, brackets,
+    and procedure calls. */
+
+    if (*aptr == NULL || id < 0 || id > cmd_listsize + 9) break;
+    cmd = cmd_getcmdstr(id);
+    cmd->arg1.block = cmd->arg2.block = NULL;
+    cmd->flags = sys_cachenumber(aptr, end);
+    cmd->misc = sys_cachenumber(aptr, end);
+    cmd->ptype1 = sys_cachenumber(aptr, end);
+    cmd->ptype2 = sys_cachenumber(aptr, end);
+    cmd->arg1type = sys_cachenumber(aptr, end);
+    cmd->arg2type = sys_cachenumber(aptr, end);
+    cmd->xflags = sys_cachenumber(aptr, end);
+    cmd->count = sys_cachenumber(aptr, end);
+    if ((cmd->flags & cmdf_arg1F) != 0)
+      cmd->arg1.block = cmd_loadblock(aptr, end);
+    else cmd->arg1.value = sys_cachenumber(aptr, end);
+    if ((cmd->flags & cmdf_arg2F) != 0)
+      cmd->arg2.block = cmd_loadblock(aptr, end);
+    else cmd->arg2.value = sys_cachenumber(aptr, end);
+    cmd->next = (cmdstr *)cmd_loadblock(aptr, end);
+    yield = (cmdblock *)cmd;
+    }
+  break;
+
+  case cb_iftype:
+    {
+    ifstr *ifblock = store_Xget(sizeof(ifstr));
+    ifblock->type = cb_iftype;
+    ifblock->if_then = (cmdstr *)cmd_loadblock(aptr, end);
+    ifblock->if_else = (cmdstr *)cmd_loadblock(aptr, end);
+    yield = (cmdblock *)ifblock;
+    }
+  break;
+
+  case cb_prtype:
+    {
+    procstr *pblock = store_Xget(sizeof(procstr));
+    pblock->type = cb_prtype;
+    pblock->flags = 0;
+    pblock->next = NULL;
+    pblock->name = loadstring(aptr, end);
+    pblock->body = (cmdstr *)cmd_loadblock(aptr, end);
+    if (pblock->name == NULL) *aptr = NULL;
+    yield = (cmdblock *)pblock;
+    }
+  break;
+  }
+
+if (yield == NULL || *aptr == NULL)
+  {
+  cmd_freeblock(yield);
+  *aptr = NULL;
+  return NULL;
+  }
+return yield;
+}
+
+
+
 /*************************************************
 *         Join on continuation line              *
 *************************************************/
@@ -640,20 +912,64 @@ main_backnext = main_backtop;
 *          Find a numbered buffer                *
 *************************************************/
 
+/* Buffers are indexed by number in a hash table, so that finding one does not
+depend on how many there are. The table is maintained by cmd_hashbuffer(). */
+
+static bufferstr *buffer_hash[BUFFER_HASH];
+
 bufferstr *
 cmd_findbuffer(int n)
 {
-bufferstr *yield = main_bufferchain;
+bufferstr *yield = buffer_hash[(usint)n % BUFFER_HASH];
 while (yield != NULL)
   {
   if (yield->bufferno == n) return yield;
-  yield = yield->next;
+  yield = yield->hashnext;
   }
 return NULL;
 }
 
 
 
+/*************************************************
+*       Add or remove buffer from hash table     *
+*************************************************/
+
+/* This must be called when a buffer is created or deleted, and also around
+any change to its number.
+
+Arguments:
+  buffer     the buffer
+  add        TRUE to add it to the hash table, FALSE to remove it
+
+Returns:     nothing
+*/
+
+void
+cmd_hashbuffer(bufferstr *buffer, BOOL add)
+{
+bufferstr **link = buffer_hash + (usint)buffer->bufferno % BUFFER_HASH;
+
+if (add)
+  {
+  buffer->hashnext = *link;
+  *link = buffer;
+  return;
+  }
+
+while (*link != NULL)
+  {
+  if (*link == buffer)
+    {
+    *link = buffer->hashnext;
+    break;
+    }
+  link = &((*link)->hashnext);
+  }
+}
+
+
+
 /*************************************************
 *             Empty a buffer                     *
 *************************************************/
@@ -696,6 +1012,8 @@ if (buffer->changed && !buffer->noprompt && main_warnings)
   if (!cmd_yesno("Continue with %s (Y/N)? ", cmdname)) return FALSE;
   }
 
+undo_discard(buffer);
+journal_end(buffer);
 line = buffer->top;
 while (line != NULL)
   {
@@ -721,7 +1039,7 @@ while (line != NULL)
     /* LCOV_EXCL_STOP */
     }
 
-  if (line->text != NULL) store_free(line->text);
+  store_freetext(line->text);
   store_free(line);
   linecount--;
   line = next;
@@ -838,11 +1156,33 @@ return TRUE;
 
 
 
+/*************************************************
+*            Procedure hash table                *
+*************************************************/
+
+/* Procedures are held in a hash table of chains, indexed by a hash of the
+name. Compiled calls of a procedure remember the procedure block once found,
+together with the table's generation number. The number is increased whenever
+a procedure is defined or cancelled, which invalidates all such bindings, so
+that a block that has been freed is never used. */
+
+static usint proc_generation = 1;
+
+static procstr **
+proc_chain(uschar *name)
+{
+usint h = 0;
+while (*name != 0) h = h*31 + *name++;
+return main_proclist + (h & (proc_hashsize - 1));
+}
+
+
+
 /*************************************************
 *              Find procedure                    *
 *************************************************/
 
-/* If found, move to top of list.
+/* If found, move to top of its chain.
 
 Arguments:
   name      required name
@@ -854,7 +1194,8 @@ Returns:    TRUE on success, FALSE if not found
 BOOL
 cmd_findproc(uschar *name, procstr **ap)
 {
-procstr *p = main_proclist;
+procstr **chain = proc_chain(name);
+procstr *p = *chain;
 procstr *pp = NULL;
 while (p != NULL)
   {
@@ -864,8 +1205,8 @@ while (p != NULL)
     if (pp != NULL)
       {
       pp->next = p->next;
-      p->next = main_proclist;
-      main_proclist = p;
+      p->next = *chain;
+      *chain = p;
       }
     return TRUE;
     }
@@ -875,4 +1216,73 @@ while (p != NULL)
 return FALSE;
 }
 
+
+
+/*************************************************
+*         Find procedure for a call              *
+*************************************************/
+
+/* The name is looked up only if the command is not already bound to a
+procedure that is still valid. The binding is held in the second argument,
+which is otherwise unused for a procedure call and is not flagged as a block,
+so it is neither copied nor freed with the command.
+
+Argument:  the procedure call command
+Returns:   the procedure, or NULL if not found
+*/
+
+procstr *
+cmd_bindproc(cmdstr *cmd)
+{
+procstr *p;
+if (cmd->bindgen == proc_generation) return (procstr *)(cmd->arg2.block);
+if (!cmd_findproc(cmd->arg1.string->text, &p)) return NULL;
+cmd->arg2.block = p;
+cmd->bindgen = proc_generation;
+return p;
+}
+
+
+
+/*************************************************
+*             Add a new procedure                *
+*************************************************/
+
+/* The caller has checked that the name is not already defined.
+
+Argument:  the procedure block
+Returns:   nothing
+*/
+
+void
+cmd_addproc(procstr *p)
+{
+procstr **chain = proc_chain(p->name);
+p->next = *chain;
+*chain = p;
+if (++proc_generation == 0) proc_generation = 1;
+}
+
+
+
+/*************************************************
+*             Delete a procedure                 *
+*************************************************/
+
+/* The procedure is removed from its chain and freed.
+
+Argument:  the procedure block
+Returns:   nothing
+*/
+
+void
+cmd_deleteproc(procstr *p)
+{
+procstr **chain = proc_chain(p->name);
+while (*chain != p) chain = &((*chain)->next);
+*chain = p->next;
+cmd_freeblock((cmdblock *)p);
+if (++proc_generation == 0) proc_generation = 1;
+}
+
 /* End of ecmdsub.c */
@@ -2,10 +2,10 @@
 *       The E text editor - 3rd incarnation      *
 *************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2025 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: March 2025 */
+/* This file last modified: October 2026 */
 
 
 /* This file contains code for interfacing to the PCRE2 library for handling
@@ -159,6 +159,7 @@ if (allow_wide)
 
 /* Do the compilation */
 
+main_stats.re_compiles++;
 qs->cre = pcre2_compile(pattern, PCRE2_ZERO_TERMINATED, options, &errorcode,
   &offset, re_compile_context);
 
@@ -251,12 +252,21 @@ if (((flags & qsef_B) != 0 && leftpos != wleft) ||
   ((flags & qsef_B) == 0 && (flags & qsef_E) != 0 && rightpos != wright))
     yield = MATCH_FAILED;
 
-/* Do the match; we may have to repeat for the count qualifier. */
+/* Do the match; we may have to repeat for the count qualifier. PCRE2 need
+not check UTF-8 that is known to be valid, provided the subject starts and ends
+at character boundaries. */
 
 else if (chars != NULL) for (;;)
   {
+  usint options = 0;
+  if (allow_wide && line_isutf8(line) &&
+      (leftpos >= line->len || (chars[leftpos] & 0xc0) != 0x80) &&
+      (rightpos >= line->len || (chars[rightpos] & 0xc0) != 0x80))
+    options = PCRE2_NO_UTF_CHECK;
+
+  main_stats.re_matches++;
   ExtractNumber = pcre2_match(qs->cre, chars + leftpos, rightpos - leftpos,
-    0, 0, re_match_data, NULL);
+    0, options, re_match_data, NULL);
   if (ExtractNumber == PCRE2_ERROR_NOMATCH) break;
   if (ExtractNumber < 0)
     {
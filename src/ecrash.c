@@ -2,10 +2,10 @@
 *       The E text editor - 3rd incarnation      *
 *************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2023 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: February 2023 */
+/* This file last modified: October 2026 */
 
 
 /* This file contains code for handling an NE crash. Needless to say, this
@@ -106,6 +106,8 @@ do
       error_printf(" from buffer %d", currentbuffer->bufferno);
       if (currentbuffer->filealias != NULL)
         error_printf(" (%s)", currentbuffer->filealias);
+      if (journal_complete(currentbuffer))
+        error_printf(" - it can also be recovered with -recover");
       }
     }
 
@@ -183,6 +185,12 @@ if (main_initialized && AllowDump)
   if (sig == SIGHUP) signal(SIGHUP, SIG_DFL);
 
   AllowDump = FALSE;          /* Prevent recursion */
+
+  /* Saves that were in progress in the background carry on in their own
+  processes. Wait for them, so that the buffers of any that fail are marked as
+  changed and are dumped. */
+
+  if (main_saving) file_savecheck(TRUE);
   main_initialized = FALSE;   /* Any more errors are fatal */
 
   dump_buffers(sys_crashfilename(TRUE));
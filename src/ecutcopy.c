@@ -2,10 +2,10 @@
 *       The E text editor - 3rd incarnation      *
 *************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2022 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: December 2022 */
+/* This file last modified: October 2026 */
 
 
 /* This file contains code for making cutting, pasting, and copying blocks of
@@ -38,7 +38,7 @@ cut_text(linestr *startline, linestr *endline, int startcol, int endcol,
   BOOL copyflag)
 {
 linestr *nextline, *cutline;
-int clen = line_charcount(startline->text, startline->len);
+int clen = line_column(startline, startline->len);
 int firstright = (startline == endline)? endcol : clen;
 
 if ((startline->flags & lf_eof) != 0) return;
@@ -60,7 +60,9 @@ else
   {
   uschar *a = startline->text + line_offset(startline, startcol);
   uschar *b = startline->text + line_offset(startline, firstright);
+  undo_suspended = TRUE;     /* cut_last is not in the buffer */
   line_insertbytes(cut_last, -1, cut_last->len, a, b - a, 0);
+  undo_suspended = FALSE;
   if (!copyflag)
     {
     line_deletech(startline,  startcol, firstright - startcol, TRUE);
@@ -73,32 +75,48 @@ else
 if (!copyflag) cursor_col = startcol;    /* final cursor position */
 if (startline == endline) return;        /* operation is all on one line */
 
-/* The operation spreads over at least one line end */
+/* The operation spreads over at least one line end. Any complete lines in
+between are dealt with as a block. */
 
 nextline = startline->next;
-while (nextline != endline && (nextline->flags & lf_eof) == 0)
+if (nextline != endline && (nextline->flags & lf_eof) == 0)
   {
-  linestr *nnextline = nextline->next;
+  linestr *first = nextline;
+  linestr *last = NULL;
+  int count = 0;
+  size_t size = 0;
 
-  /* Copy the line or cut it out of the normal chain. */
+  /* When cutting, mark the lines that are in the back list, so that those
+  within the block can be found as it is scanned. */
 
-  if (copyflag)
+  if (!copyflag)
     {
-    nextline = line_copy(nextline);
+    for (usint i = 0; i <= main_backtop; i++)
+      if (main_backlist[i].line != NULL) main_backlist[i].line->flags |= lf_back;
     }
-  else
-    {
-    startline->next = nnextline;
-    nnextline->prev = startline;
-    main_linecount--;
 
-    /* Remove line from the back list. There is only ever one instance of a
-    line on this list. */
+  /* Scan the block, making copies if copying, or counting the lines and their
+  size and removing any from the back list if cutting. There is only ever one
+  instance of a line on the back list. */
 
-    for (usint i = 0; i <= main_backtop; i++)
+  while (nextline != endline && (nextline->flags & lf_eof) == 0)
+    {
+    if (copyflag)
       {
-      if (main_backlist[i].line == nnextline)
+      linestr *copy = line_copy(nextline);
+      cut_last->next = copy;
+      copy->prev = cut_last;
+      cut_last = copy;
+      }
+    else
+      {
+      count++;
+      size += sizeof(linestr) + nextline->len;
+      if ((nextline->flags & lf_back) != 0)
         {
+        usint i;
+        nextline->flags &= ~lf_back;
+        for (i = 0; main_backlist[i].line != nextline; i++);
         if (main_backtop == 0)
           {
           /* Not sure if this can ever actually be the case. */
@@ -111,27 +129,54 @@ while (nextline != endline && (nextline->flags & lf_eof) == 0)
           if (main_backnext == main_backtop) main_backnext--;
           main_backtop--;
           }
-        break;
         }
       }
+    last = nextline;
+    nextline = nextline->next;
     }
 
-  /* Flatten line number, and add to cut buffer chain */
+  /* When cutting, unmark the rest of the back list, splice the block out of
+  the buffer, and adjust the line count. If changes are being recorded for
+  undoing, the block is handed to the undo journal and the cut buffer gets
+  copies; otherwise the block itself is added to the cut buffer. */
+
+  if (!copyflag)
+    {
+    for (usint i = 0; i <= main_backtop; i++)
+      if (main_backlist[i].line != NULL)
+        main_backlist[i].line->flags &= ~lf_back;
 
-  nextline->key = 0;
-  cut_last->next = nextline;
-  nextline->prev = cut_last;
-  nextline->next = NULL;
-  cut_last = nextline;
+    startline->next = nextline;
+    nextline->prev = startline;
+    main_linecount -= count;
+    journal_removed(first, count, startline);
 
-  /* And carry on */
+    if (undo_active() && undo_fits(size))
+      {
+      undo_removed(first, last, count, startline, nextline);
+      for (linestr *line = first;; line = line->next)
+        {
+        linestr *copy = line_copy(line);
+        cut_last->next = copy;
+        copy->prev = cut_last;
+        cut_last = copy;
+        if (line == last) break;
+        }
+      }
+    else
+      {
+      cut_last->next = first;
+      first->prev = cut_last;
+      cut_last = last;
+      }
+    }
 
-  nextline = nnextline;
+  cut_last->next = NULL;
   }
 
 /* Now take out the initial part of the final line */
 
-clen = line_charcount(nextline->text, nextline->len);
+clen = line_column(nextline, nextline->len);
 if (endcol > clen) endcol = clen;
 cutline = line_cutpart(nextline, 0, endcol, copyflag);
 cut_last->next = cutline;
@@ -176,7 +221,7 @@ static void
 cut_deletetext(linestr *startline, linestr *endline, int startcol, int endcol)
 {
 linestr *nextline;
-int clen = line_charcount(startline->text, startline->len);
+int clen = line_column(startline, startline->len);
 int firstright = (startline == endline)? endcol : clen;
 
 if ((startline->flags & lf_eof) != 0) return;
@@ -206,7 +251,7 @@ while (nextline != endline && (nextline->flags & lf_eof) == 0)
 
 /* Now take out the initial part of the final line */
 
-clen = line_charcount(nextline->text, nextline->len);
+clen = line_column(nextline, nextline->len);
 if (endcol > clen) endcol = clen;
 line_deletech(nextline, 0, endcol, TRUE);
 nextline->flags |= lf_shn;
@@ -262,7 +307,7 @@ else
   {
   line_insertbytes(line, cursor_col, -1, pline->text, pline->len, 0);
   line->flags |= lf_shn;
-  cursor_col += line_charcount(pline->text, pline->len);
+  cursor_col += line_column(pline, pline->len);
   pline = pline->next;
 
   /* If there are no more buffers of text, we are done. Otherwise, split the
@@ -273,20 +318,37 @@ else
   main_current = ateof? line->next : line_split(line, cursor_col);
   }
 
-/* Now insert all but the last buffer as independent lines. Ensure that the
-chain of lines is correct at all times. */
+/* Now insert all but the last buffer as independent lines. Copies are built
+into a separate chain, which is then spliced in, with the line count adjusted
+once. Lines that were cut out of a buffer may still have their original line
+numbers, so these are flattened. The whole block is recorded for undoing as a
+single insertion. */
 
-while (pline->next != NULL)
+if (pline->next != NULL)
   {
-  linestr *nline = line_copy(pline);
-  if (line == NULL) main_top = nline; else line->next = nline;
-  main_current->prev = nline;
-  nline->next = main_current;
-  nline->prev = line;
-  nline->flags |= lf_shn;
-  line = nline;
-  pline = pline->next;
-  main_linecount++;
+  linestr *firstnew = NULL;
+  linestr *lastnew = NULL;
+  int newcount = 0;
+
+  for (; pline->next != NULL; pline = pline->next)
+    {
+    linestr *nline = line_copy(pline);
+    nline->key = 0;
+    nline->flags |= lf_shn;
+    nline->prev = lastnew;
+    if (lastnew == NULL) firstnew = nline; else lastnew->next = nline;
+    lastnew = nline;
+    newcount++;
+    }
+
+  if (line == NULL) main_top = firstnew; else line->next = firstnew;
+  firstnew->prev = line;
+  lastnew->next = main_current;
+  main_current->prev = lastnew;
+  main_linecount += newcount;
+  line = lastnew;
+
+  undo_inserted(firstnew, lastnew, newcount);
   }
 
 /* Now insert final section of data. However, we want to avoid adding zero
@@ -297,7 +359,7 @@ if (pline->len > 0)
   line_insertbytes(main_current, 0, -1, pline->text, pline->len, 0);
 
 main_current->flags |= lf_shn;
-cursor_col = line_charcount(pline->text, pline->len);
+cursor_col = line_column(pline, pline->len);
 cmd_recordchanged(main_current, cursor_col);
 
 /* Compute the number of "newlines" added */
@@ -529,7 +591,7 @@ else
     while (cut_buffer != NULL)
       {
       linestr *next = cut_buffer->next;
-      store_free(cut_buffer->text);
+      store_freetext(cut_buffer->text);
       store_free(cut_buffer);
       cut_buffer = next;
       }
@@ -2,10 +2,10 @@
 *       The E text editor - 3rd incarnation      *
 *************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2023 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: February 2023 */
+/* This file last modified: October 2026 */
 
 
 /* This file contains code for displaying a screenful of lines. */
@@ -29,6 +29,302 @@ static linestr *scrn_topline;
 
 
 
+/*************************************************
+*         Screen column layouts for lines        *
+*************************************************/
+
+/* On a UTF-8 terminal, a double-width character uses two screen cells, so the
+screen column of a character is not the same as its character column; finding
+it means adding up the widths of the characters before it. A line that has no
+double-width characters has lf_narrow set, and then the columns are the same.
+For a long line that has double-width characters, a layout holding the byte
+offset and cell number of every LAYOUT_STEP'th character is built when it is
+first needed, so that placing the cursor, or starting the display after a
+horizontal scroll, scans at most LAYOUT_STEP characters.
+
+The layouts for the most recently used lines are kept here, and managed in the
+same way as the character indexes in eline.c. A line has lf_layout set when it
+has been given a layout. Both bits are cleared by undo_text() when the line's
+text changes, and a layout is used only if the text's address and length are
+also unchanged. */
+
+typedef struct {
+  linestr *line;             /* the line */
+  uschar  *text;             /* its text when the layout was built */
+  usint    len;              /* its length when the layout was built */
+  usint    chars;            /* number of characters in the text */
+  usint    cells;            /* number of cells they use */
+  usint   *offsets;          /* byte offsets of every LAYOUT_STEP'th char */
+  usint   *columns;          /* cell numbers of the same characters */
+  usint    count;            /* number of entries */
+  usint    max;              /* size of the vectors */
+} layoutstr;
+
+static layoutstr layout[LAYOUT_CACHE];
+static int layout_next = 0;
+
+
+/* Scan forward over the characters in a line, adding up the cells that they
+use. The scan stops after a given number of characters, before a character
+that would take the number of cells past a maximum, or at the end of the line.
+
+Arguments:
+  line       the line
+  poffset    points to the byte offset, updated
+  pcells     points to the cell number at that offset, updated
+  n          maximum number of characters
+  maxcells   maximum number of cells
+
+Returns:     the number of characters scanned
+*/
+
+static usint
+scancells(linestr *line, usint *poffset, usint *pcells, usint n, usint maxcells)
+{
+uschar *p = line->text + *poffset;
+uschar *pe = line->text + line->len;
+usint cells = *pcells;
+usint i;
+BOOL valid = line_isutf8(line);
+
+for (i = 0; i < n && p < pe; i++)
+  {
+  uschar *pp = p;
+  usint w;
+  int c;
+  if (valid)
+    {
+    GETUTF8INC(c, p);
+    }
+  else
+    {
+    GETCHARINC(c, p, pe);
+    }
+  w = CHARCELLS(c);
+  if (cells + w > maxcells)
+    {
+    p = pp;
+    break;
+    }
+  cells += w;
+  }
+
+*poffset = p - line->text;
+*pcells = cells;
+return i;
+}
+
+
+/* Find the layout for a line, building it if necessary. If the line turns out
+to have no double-width characters, lf_narrow is set and NULL is returned.
+
+Argument:  the line, which has text and contains multibyte characters
+Returns:   the layout or NULL
+*/
+
+static layoutstr *
+getlayout(linestr *line)
+{
+layoutstr *lt;
+usint chars, cells, offset, n;
+
+if ((line->flags & lf_layout) != 0)
+  {
+  for (int i = 0; i < LAYOUT_CACHE; i++)
+    {
+    lt = layout + i;
+    if (lt->line == line && lt->text == line->text && lt->len == line->len)
+      return lt;
+    }
+  }
+
+/* Re-use the least recently built layout. It is taken away from its previous
+line at once, and it is left free if the new line turns out to be narrow. */
+
+lt = layout + layout_next;
+lt->line = NULL;
+n = line->len/LAYOUT_STEP + 2;
+if (lt->max < n)
+  {
+  store_free(lt->offsets);
+  store_free(lt->columns);
+  lt->offsets = store_Xget(n * sizeof(usint));
+  lt->columns = store_Xget(n * sizeof(usint));
+  lt->max = n;
+  }
+
+lt->count = 0;
+offset = cells = chars = 0;
+for (;;)
+  {
+  lt->offsets[lt->count] = offset;
+  lt->columns[lt->count++] = cells;
+  n = scancells(line, &offset, &cells, LAYOUT_STEP, BIGNUMBER);
+  chars += n;
+  if (n < LAYOUT_STEP || offset >= line->len) break;
+  }
+
+if (cells == chars)
+  {
+  line->flags |= lf_narrow;
+  return NULL;
+  }
+
+layout_next = (layout_next + 1) % LAYOUT_CACHE;
+lt->line = line;
+lt->text = line->text;
+lt->len = line->len;
+lt->chars = chars;
+lt->cells = cells;
+line->flags |= lf_layout;
+return lt;
+}
+
+
+
+/*************************************************
+*   Check for double-width characters in line    *
+*************************************************/
+
+/* Argument:  the line
+   Returns:   TRUE if every character in the line uses one screen cell
+*/
+
+BOOL
+scrn_narrow(linestr *line)
+{
+if (!allow_wide || !main_utf8terminal || line == NULL || line->text == NULL ||
+    (line->flags & (lf_ascii|lf_narrow|lf_eof)) != 0)
+  return TRUE;
+
+if (line->len >= LAYOUT_MIN) return getlayout(line) == NULL;
+
+/* A short line is scanned all through once to see if it is narrow; after that
+it is scanned for each query. */
+
+  {
+  usint offset = 0;
+  usint cells = 0;
+  usint chars = scancells(line, &offset, &cells, BIGNUMBER, BIGNUMBER);
+  if (chars != cells) return FALSE;
+  line->flags |= lf_narrow;
+  return TRUE;
+  }
+}
+
+
+
+/*************************************************
+*      Find the cell for a character in a line   *
+*************************************************/
+
+/* This is the number of cells used by the characters to the left of the given
+character column. Past the end of the line, there is one cell per column.
+
+Arguments:
+  line       the line
+  col        the character column
+
+Returns:     the cell number
+*/
+
+static usint
+cellcol(linestr *line, usint col)
+{
+usint offset = 0;
+usint cells = 0;
+usint n;
+
+if (scrn_narrow(line)) return col;
+
+if (line->len >= LAYOUT_MIN)
+  {
+  layoutstr *lt = getlayout(line);
+  if (col >= lt->chars) return lt->cells + col - lt->chars;
+  offset = lt->offsets[col/LAYOUT_STEP];
+  cells = lt->columns[col/LAYOUT_STEP];
+  col %= LAYOUT_STEP;
+  }
+
+n = scancells(line, &offset, &cells, col, BIGNUMBER);
+return cells + col - n;
+}
+
+
+
+/*************************************************
+*      Find screen column for character          *
+*************************************************/
+
+/* The screen is scrolled horizontally by a number of characters, so each line
+starts with its cursor_offset'th character. The result is negative if the
+character is to the left of the screen.
+
+Arguments:
+  line       the line, or NULL for a blank line
+  col        the character column
+
+Returns:     the screen column
+*/
+
+int
+scrn_screencol(linestr *line, usint col)
+{
+if (scrn_narrow(line)) return (int)col - (int)cursor_offset;
+return (int)cellcol(line, col) - (int)cellcol(line, cursor_offset);
+}
+
+
+
+/*************************************************
+*      Find character for screen column          *
+*************************************************/
+
+/* This is the inverse of scrn_screencol(). The result is the character that
+uses the given screen cell, which may be the right-hand half of a double-width
+character.
+
+Arguments:
+  line       the line, or NULL for a blank line
+  x          the screen column
+
+Returns:     the character column
+*/
+
+usint
+scrn_charcol(linestr *line, usint x)
+{
+usint offset = 0;
+usint cells = 0;
+usint chars = 0;
+usint target;
+
+if (scrn_narrow(line)) return x + cursor_offset;
+target = x + cellcol(line, cursor_offset);
+
+if (line->len >= LAYOUT_MIN)
+  {
+  layoutstr *lt = getlayout(line);
+  usint bot = 0;
+  usint top = lt->count;
+  if (target >= lt->cells) return lt->chars + target - lt->cells;
+  while (top - bot > 1)
+    {
+    usint mid = (bot + top)/2;
+    if (lt->columns[mid] <= target) bot = mid; else top = mid;
+    }
+  offset = lt->offsets[bot];
+  cells = lt->columns[bot];
+  chars = bot * LAYOUT_STEP;
+  }
+
+chars += scancells(line, &offset, &cells, BIGNUMBER, target);
+if (offset >= line->len) chars += target - cells;
+return chars;
+}
+
+
+
 /*************************************************
 *          Hint Entry from Main Program          *
 *************************************************/
@@ -233,7 +529,7 @@ Returns:       nothing
 void
 scrn_invertchars(linestr *line, int row, int col, int count, int flag)
 {
-int len;
+int len, x;
 uschar *p, *pe;
 
 if ((line->flags & lf_eof) != 0)
@@ -251,10 +547,12 @@ else
 
 pe = p + len;
 p += line_soffset(p, p + len, col);
-s_move(col - cursor_offset, row);
+x = scrn_screencol(line, col);
+if (x < 0 || x > (int)window_width) return;
+s_move(x, row);
 if (flag) s_rendition(s_r_inverse);
 
-for (int i = 1; i <= count; i++)
+for (int i = 1; i <= count && x <= (int)window_width; i++)
   {
   int k;
   if (p < pe)
@@ -263,6 +561,7 @@ for (int i = 1; i <= count; i++)
     }
   else k = ' ';
   s_putc(k);
+  x += CHARCELLS(k);
   }
 
 if (flag) s_rendition(s_r_normal);
@@ -270,11 +569,115 @@ if (flag) s_rendition(s_r_normal);
 
 
 
+/*************************************************
+*        Byte offsets of displayed rows          *
+*************************************************/
+
+/* When the screen is scrolled horizontally, each row starts part of the way
+along its line. In a line with multibyte characters, finding the byte offset of
+the first character that is shown means scanning the line, or using its
+character index, and there may be more long lines on the screen than there are
+cached indexes. So the offset at which each row was last displayed is kept, and
+when the scroll changes, the new offset is found by moving over just the
+characters between the two. A line has lf_rowstart set when it may have a row
+offset; the bit is cleared whenever the line's text changes. */
+
+typedef struct {
+  linestr *line;             /* the line displayed on the row */
+  uschar  *text;             /* its text at the time */
+  usint    len;              /* its length at the time */
+  usint    col;              /* the character column */
+  usint    offset;           /* and its byte offset */
+} rowstartstr;
+
+static rowstartstr *rowstart = NULL;
+static usint rowstart_max = 0;
+
+
+/* Find the byte offset of the character at which a row's display starts.
+
+Arguments:
+  line       the line, which has text
+  row        the screen row
+  col        the character column
+
+Returns:     the byte offset
+*/
+
+static usint
+rowoffset(linestr *line, int row, usint col)
+{
+rowstartstr *rs;
+usint offset;
+
+if (!allow_wide || (line->flags & lf_ascii) != 0 || row < 0 ||
+    row > (int)screen_max_row)
+  return line_offset(line, col);
+
+if (rowstart_max <= screen_max_row)
+  {
+  store_free(rowstart);
+  rowstart_max = screen_max_row + 1;
+  rowstart = store_Xget(rowstart_max * sizeof(rowstartstr));
+  memset(rowstart, 0, rowstart_max * sizeof(rowstartstr));
+  }
+
+rs = rowstart + row;
+
+if ((line->flags & lf_rowstart) != 0 && rs->line == line &&
+     rs->text == line->text && rs->len == line->len && rs->offset <= line->len)
+  {
+  if (col == rs->col) return rs->offset;
+
+  if (col > rs->col)
+    offset = rs->offset + utf8_offset(line->text + rs->offset,
+      line->len - rs->offset, col - rs->col, line->flags);
+
+  /* Moving back is done only in valid UTF-8, where it is unambiguous. */
+
+  else if (line_isutf8(line))
+    {
+    uschar *p = line->text + rs->offset;
+    for (usint n = rs->col - col; n > 0; n--) { BACKCHAR(p, line->text); }
+    offset = p - line->text;
+    }
+
+  else offset = line_offset(line, col);
+  }
+
+/* Otherwise, if the line's bit has been cleared because its text has changed,
+forget any other row that has the line, because setting the bit again would
+make that row's offset look valid. */
+
+else
+  {
+  offset = line_offset(line, col);
+  if ((line->flags & lf_rowstart) == 0)
+    {
+    for (usint i = 0; i < rowstart_max; i++)
+      if (rowstart[i].line == line) rowstart[i].line = NULL;
+    }
+  }
+
+rs->line = line;
+rs->text = line->text;
+rs->len = line->len;
+rs->col = col;
+rs->offset = offset;
+line->flags |= lf_rowstart;
+return offset;
+}
+
+
+
 /*************************************************
 *          Display a single line                 *
 *************************************************/
 
-/* The mark and global mark positions are shown in inverse video.
+/* The mark and global mark positions are shown in inverse video. Each
+character uses one screen cell, except for double-width characters on a UTF-8
+terminal, which use two. The last character on the screen is shown in inverse
+video if the line continues beyond it.
 
 Arguments:
   line        line being displayed or NULL
@@ -284,19 +687,42 @@ Arguments:
 Returns:      nothing
 */
 
-void
-scrn_displayline(linestr *line, int row, int col)
+static void
+displayline(linestr *line, int row, int col)
 {
-int scol = col - cursor_offset;
+int scol;
 int mcol = BIGNUMBER;
 int mcol_global = BIGNUMBER;
+usint mchar = BIGNUMBER;
+usint mchar_global = BIGNUMBER;
+
+main_stats.screen_lines++;
+if (col < (int)cursor_offset) col = cursor_offset;
+scol = (col == (int)cursor_offset)? 0 : scrn_screencol(line, col);
+
+/* Nothing is visible if the starting character is off the right of the
+screen, which can happen on a line with double-width characters. */
+
+if (scol > (int)window_width)
+  {
+  if (line != NULL) line->flags &= ~lf_shbits;
+  return;
+  }
 
 s_move(scol, row);
 
 if (line != NULL)
   {
-  if (line == mark_line) mcol = (int)mark_col - (int)cursor_offset;
-  if (line == mark_line_global) mcol_global = mark_col_global - cursor_offset;
+  if (line == mark_line)
+    {
+    mchar = mark_col;
+    mcol = scrn_screencol(line, mark_col);
+    }
+  if (line == mark_line_global)
+    {
+    mchar_global = mark_col_global;
+    mcol_global = scrn_screencol(line, mark_col_global);
+    }
 
   if ((line->flags & lf_eof) != 0)
     {
@@ -306,22 +732,35 @@ if (line != NULL)
     }
   else if (line->text != NULL)
     {
-    uschar *p = line->text + line_offset(line, col);
+    uschar *p = line->text + rowoffset(line, row, col);
     uschar *pe = line->text + line->len;
+    BOOL valid = allow_wide && line_isutf8(line);
+
+    usint c = col;
 
     while (p < pe)
       {
-      int ch;
-      GETCHARINC(ch, p, pe);
-      if ((scol == (int)window_width && p < pe - 1) || scol == mcol ||
-           scol == mcol_global)
+      int ch, w;
+      if (valid)
+        {
+        GETUTF8INC(ch, p);
+        }
+      else
+        {
+        GETCHARINC(ch, p, pe);
+        }
+      w = CHARCELLS(ch);
+      if ((scol + w > (int)window_width && p < pe - 1) || c == mchar ||
+           c == mchar_global)
         {
         s_rendition(s_r_inverse);
         s_putc(ch);
         s_rendition(s_r_normal);
         }
       else s_putc(ch);
-      if (scol++ >= (int)window_width) break;
+      c++;
+      scol += w;
+      if (scol > (int)window_width) break;
       }
     }
 
@@ -346,6 +785,23 @@ if (line != NULL && mcol != BIGNUMBER && scol <= mcol &&
   scrn_invertchars(line, row, mark_col, 1, TRUE);
 }
 
+/* Lines are redisplayed both by scrn_display() and directly after simple
+changes, so both count as display time in a trace. */
+
+void
+scrn_displayline(linestr *line, int row, int col)
+{
+int oldphase;
+if (trace_fid == NULL)
+  {
+  displayline(line, row, col);
+  return;
+  }
+oldphase = trace_phase(trace_display);
+displayline(line, row, col);
+(void)trace_phase(oldphase);
+}
+
 
 
 /*************************************************
@@ -431,11 +887,11 @@ while (row <= window_depth)
 
   else if (line != NULL && (line->flags & lf_clend) != 0)
     {
-    usint endcol = line->len - cursor_offset;
+    int endcol = scrn_screencol(line, line_column(line, line->len));
 #ifdef logging
     debug_writelog("clearendline %d\n", row);
 #endif
-    if (endcol <= window_width)
+    if (endcol >= 0 && endcol <= (int)window_width)
       {
       s_move(endcol, row);
       s_eraseright();
@@ -462,19 +918,26 @@ void
 scrn_display(void)
 {
 int above = -1;
+int oldphase = 0;
 usint newoffset = 0;
 
+if (trace_fid != NULL) oldphase = trace_phase(trace_display);
+
 #ifdef logging
 debug_writelog(">>>>Start of scrn_display()\n");
 #endif
 
 /* Set up the offset so that the current position is visible. There's a fudge
 variable that can be set to cause horizontal scrolling when the cursor is near
-the right- hand side (used by the G commands). */
+the right- hand side (used by the G commands). The position is measured in
+screen cells, because the current line may contain double-width characters. */
 
-if (cursor_col < cursor_offset || cursor_col > cursor_max - cursor_rh_adjust)
+if (cursor_col < cursor_offset || scrn_screencol(main_current, cursor_col) >
+    (int)(window_width - cursor_rh_adjust))
   {
-  while (cursor_col > newoffset + window_width - cursor_rh_adjust)
+  while (scrn_screencol(main_current, cursor_col) -
+         scrn_screencol(main_current, newoffset) >
+         (int)(window_width - cursor_rh_adjust))
     newoffset += scrn_hscrollamount;
   if (cursor_offset != newoffset)
     {
@@ -571,12 +1034,14 @@ if (screen_autoabove && above < 0)
 
 screen_autoabove = TRUE;
 makescreen(above);          /* Adjusts cursor_row */
-s_move(cursor_col - cursor_offset, cursor_row);
+s_move(scrn_screencol(main_current, cursor_col), cursor_row);
 screen_forcecls = FALSE;
 
 #ifdef logging
 debug_writelog("End of scrn_display()\n");
 #endif
+
+if (trace_fid != NULL) (void)trace_phase(oldphase);
 }
 
 /* End of edisplay.c */
@@ -2,10 +2,10 @@
 *       The E text editor - 3rd incarnation      *
 *************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2023 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: February 2023 */
+/* This file last modified: October 2026 */
 
 
 /* This file contains code for obeying commands: Part I */
@@ -61,6 +61,8 @@ switch(cmd->misc)
   case '%':
   case '~':
 
+  undo_text(main_current);
+  line_unshare(main_current);
   p = main_current->text + line_offset(main_current, cursor_col);
   pe = main_current->text + main_current->len;
 
@@ -91,9 +93,9 @@ return done_continue;
 int
 e_obeyproc(cmdstr *cmd)
 {
-procstr *p;
+procstr *p = cmd_bindproc(cmd);
 
-if (cmd_findproc(cmd->arg1.string->text, &p))
+if (p != NULL)
   {
   int yield;
   BOOL wasactive = (p->flags & pr_active) != 0;
@@ -238,6 +240,12 @@ return done_continue;
 
  /* They all call the same function. */
 
+/* The serial number of the command whose arguments were last saved is
+remembered, so that they are not copied again each time the same compiled
+command is obeyed, for example in a loop. */
+
+static usint last_abese_serial = 0;
+
 int
 e_abe(cmdstr *cmd)
 {
@@ -263,10 +271,14 @@ if ((main_current->flags & lf_eof))
 
 if ((cmd->flags & cmdf_arg1) != 0)
   {
-  if (last_abese != NULL) cmd_freeblock((cmdblock *)last_abese);
-  if (last_abent != NULL) cmd_freeblock((cmdblock *)last_abent);
-  last_abese = cmd_copyblock((cmdblock *)se);
-  last_abent = cmd_copyblock((cmdblock *)nt);
+  if (cmd->serial != last_abese_serial)
+    {
+    if (last_abese != NULL) cmd_freeblock((cmdblock *)last_abese);
+    if (last_abent != NULL) cmd_freeblock((cmdblock *)last_abent);
+    last_abese = cmd_copyblock((cmdblock *)se);
+    last_abent = cmd_copyblock((cmdblock *)nt);
+    last_abese_serial = cmd->serial;
+    }
   }
 else if (last_abese == NULL)
   {
@@ -338,7 +350,7 @@ if ((matchrc = cmd_matchse(se, main_current)) == MATCH_OK)
   /* Correct cursor_col from byte to char offset, and note the line has
   changed. */
 
-  cursor_col = line_charcount(main_current->text, cursor_col);
+  cursor_col = line_column(main_current, cursor_col);
   main_current->flags |= lf_shn;
   }
 
@@ -867,7 +879,7 @@ first line plus the joining string */
 
 main_current = line_concat(main_current->next, slen);
 memcpy(main_current->text + len, s, slen);
-cursor_col = line_charcount(main_current->text, len + slen);
+cursor_col = line_column(main_current, len + slen);
 
 main_current->flags |= lf_shn;
 cmd_refresh = TRUE;
@@ -904,10 +916,9 @@ if (cmd_findproc(cmd->arg1.string->text, &p))
     error_moan(47, cmd->arg1.string->text);
     return done_error;
     }
-  else  /* A found procedure is always moved to the top of the list */
+  else
     {
-    main_proclist = p->next;
-    cmd_freeblock((cmdblock *)p);
+    cmd_deleteproc(p);
     return done_continue;
     }
   }
@@ -1064,12 +1075,15 @@ while (buffer != deletebuffer)
 
 if (!cmd_emptybuffer(buffer, US"DBUFFER")) return done_error;
 
-/* If buffer is the only buffer, set it up as empty; otherwise,
-select another buffer if it is current, and then wipe it out. */
+/* If buffer is the only buffer, set it up as empty, renumbered as zero;
+otherwise, select another buffer if it is current, and then wipe it out. */
+
+cmd_hashbuffer(buffer, FALSE);
 
 if (buffer == main_bufferchain && buffer->next == NULL)
   {
   init_buffer(buffer, 0, store_copystring(US""), store_copystring(US""), NULL);
+  cmd_hashbuffer(buffer, TRUE);
   currentbuffer = NULL;
   init_selectbuffer(buffer);
   }
@@ -1100,7 +1114,7 @@ e_dcut(cmdstr *cmd)
 while (cut_buffer != NULL)
   {
   linestr *next = cut_buffer->next;
-  store_free(cut_buffer->text);
+  store_freetext(cut_buffer->text);
   store_free(cut_buffer);
   cut_buffer = next;
   }
@@ -1165,6 +1179,7 @@ if (cmd->misc == detrail_buffer)
     while (t > s && t[-1] == ' ') t--;
     if (t - s < line->len)
       {
+      undo_text(line);
       line->len = t - s;
       main_filechanged = TRUE;
       }
@@ -1210,7 +1225,8 @@ line, but just in case... */
 /* LCOV_EXCL_START */
 if ((main_bottom->flags & lf_eof) == 0)
   {
-  store_free(main_bottom->text);
+  undo_text(main_bottom);
+  store_freetext(main_bottom->text);
   main_bottom->text = NULL;
   main_bottom->len = 0;
   main_bottom->flags |= lf_eof;
@@ -1283,7 +1299,7 @@ while (cursor_byte > 0 &&
   (ch_tab[(p[cursor_byte])] & ch_word) != 0) cursor_byte--;
 if ((ch_tab[(p[cursor_byte])] & ch_word) == 0) cursor_byte++;
 
-cursor_col = line_charcount(main_current->text, cursor_byte);
+cursor_col = line_column(main_current, cursor_byte);
 count = oldcursor - cursor_col;
 if (count > 0)
   {
@@ -1313,7 +1329,7 @@ if (cursor_byte >= len) cursor_byte = len;
 while (cursor_byte < len && (ch_tab[(p[cursor_byte])] & ch_word) != 0) cursor_byte++;
 while (cursor_byte < len && (ch_tab[(p[cursor_byte])] & ch_word) == 0) cursor_byte++;
 
-count = line_charcount(main_current->text, cursor_byte) - cursor_col;
+count = line_column(main_current, cursor_byte) - cursor_col;
 if (count > 0)
   {
   line_deletech(main_current, cursor_col, count, TRUE);
@@ -2,10 +2,10 @@
 *       The E text editor - 3rd incarnation      *
 *************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2023 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: February 2023 */
+/* This file last modified: October 2026 */
 
 
 /* This file contains code for obeying commands: Part II */
@@ -16,6 +16,13 @@
 #include "shdr.h"
 
 
+/* Serial numbers of the commands whose arguments were last saved for re-use
+by F/BF and by GA/GB/GE. */
+
+static usint last_se_serial = 0;
+static usint last_gse_serial = 0;
+
+
 /*************************************************
 *          The F & BF commands                   *
 *************************************************/
@@ -34,12 +41,18 @@ usint cursor_byte = line_offset(line, cursor_col);
 
 match_L = cmd->misc;                 /* Global indicating lefwards matching */
 
-/* Deal with saving and repeated search */
+/* Deal with saving and repeated search. When the same compiled command is
+obeyed repeatedly (typically in a loop) the saved copy is already correct, so
+there is no need to copy it again. */
 
 if ((cmd->flags & cmdf_arg1) != 0)
   {
-  if (last_se != NULL) cmd_freeblock((cmdblock *)last_se);
-  last_se = cmd_copyblock((cmdblock *)se);
+  if (cmd->serial != last_se_serial)
+    {
+    if (last_se != NULL) cmd_freeblock((cmdblock *)last_se);
+    last_se = cmd_copyblock((cmdblock *)se);
+    last_se_serial = cmd->serial;
+    }
   }
 else if (last_se == NULL)
   {
@@ -93,7 +106,7 @@ if ((line->flags & lf_eof) == 0 || match_L)
 if (matched == MATCH_OK)
   {
   main_current = line;
-  cursor_col = line_charcount(line->text, match_L? match_start : match_end);
+  cursor_col = line_column(line, match_L? match_start : match_end);
   return done_continue;
   }
 
@@ -210,10 +223,14 @@ qsstr *nt = cmd->arg2.qs;
 
 if ((cmd->flags & cmdf_arg1) != 0)
   {
-  if (last_gse != NULL) cmd_freeblock((cmdblock *)last_gse);
-  if (last_gnt != NULL) cmd_freeblock((cmdblock *)last_gnt);
-  last_gse = cmd_copyblock((cmdblock *)se);
-  last_gnt = cmd_copyblock((cmdblock *)nt);
+  if (cmd->serial != last_gse_serial)
+    {
+    if (last_gse != NULL) cmd_freeblock((cmdblock *)last_gse);
+    if (last_gnt != NULL) cmd_freeblock((cmdblock *)last_gnt);
+    last_gse = cmd_copyblock((cmdblock *)se);
+    last_gnt = cmd_copyblock((cmdblock *)nt);
+    last_gse_serial = cmd->serial;
+    }
   }
 else if (last_gse == NULL)
   {
@@ -298,7 +315,7 @@ while (Gcontinue)
 
   if (matched == MATCH_OK)
     {
-    usint boldcol = line_charcount(line->text, match_start);
+    usint boldcol = line_column(line, match_start);
     usint boldcount = line_charcount(line->text + match_start,
                                       match_end - match_start);
     if (boldcount == 0) boldcount = 1;
@@ -483,7 +500,7 @@ while (Gcontinue)
 
     /* Correct cursor column from byte to character offset */
 
-    cursor_col = line_charcount(line->text, cursor_col);
+    cursor_col = line_column(line, cursor_col);
     }
 
   /* No match has been found */
@@ -600,6 +617,7 @@ if ((cmd->flags & cmdf_arg1) != 0)
     if (prev == NULL) main_top = topline; else prev->next = topline;
     main_current->prev = line;
     main_linecount += count;
+    undo_inserted(topline, line, count);
 
     cmd_recordchanged(main_current, cursor_col);
     cmd_recordchanged(topline, 0);
@@ -607,7 +625,7 @@ if ((cmd->flags & cmdf_arg1) != 0)
     if (main_screenOK) scrn_hint(sh_insert, count, NULL);
     }
 
-  store_free(botline->text);
+  store_freetext(botline->text);
   store_free(botline);
   fclose(f);
   return done_continue;
@@ -678,7 +696,7 @@ else
     if (eof || main_interrupted(ci_read) ||
       (line->len == 1 && tolower(line->text[0]) == 'z'))
         {
-        store_free(line->text);
+        store_freetext(line->text);
         store_free(line);
         break;
         }
@@ -694,6 +712,7 @@ else
   main_linecount += count;
   if (count > 0)
     {
+    undo_inserted(topline, prev, count);
     cmd_recordchanged(main_current, cursor_col);
     if (topline != NULL) cmd_recordchanged(topline, 0);
     }
@@ -729,6 +748,7 @@ newline->prev = prev;
 newline->next = main_current;
 main_current->prev = newline;
 main_linecount++;
+undo_inserted(newline, newline, 1);
 cmd_recordchanged(main_current, cursor_col);
 if (main_screenOK) scrn_hint(sh_insert, 1, NULL);
 cmd_refresh = TRUE;
@@ -825,6 +845,7 @@ main_current->prev = line;
 if (prev == NULL) main_top = line; else prev->next = line;
 
 main_linecount++;
+undo_inserted(line, line, 1);
 cmd_recordchanged(main_current, cursor_col);
 if (main_screenOK) scrn_hint(sh_insert, 1, NULL);
 cmd_refresh = TRUE;
@@ -902,8 +923,11 @@ return key_set(cmd->arg1.string->text, TRUE)? done_continue : done_error;
 static
 int lettercase(int (*func)(int))
 {
-uschar *p = main_current->text + line_offset(main_current, cursor_col);
-uschar *pe = main_current->text + main_current->len;
+uschar *p, *pe;
+undo_text(main_current);
+line_unshare(main_current);
+p = main_current->text + line_offset(main_current, cursor_col);
+pe = main_current->text + main_current->len;
 while (p < pe)
   {
   if (*p < 128) *p = func(*p);
@@ -930,6 +954,7 @@ e_load (cmdstr *cmd)
 uschar *s = (cmd->arg1.string)->text;
 bufferstr *buffer = currentbuffer;
 bufferstr *next = currentbuffer->next;
+bufferstr *hashnext = currentbuffer->hashnext;
 int n = currentbuffer->bufferno;
 int yield = done_continue;
 BOOL noprompt = currentbuffer->noprompt || !main_warnings;
@@ -946,12 +971,13 @@ if ((fid = sys_fopen(s, US"r")) == NULL)
   s = US"";
   }
 
-/* Re-initialize buffer (destroys the next and noprompt fields; also the
-windowtitle and windowhandle fields; gets a new back list). */
+/* Re-initialize buffer (destroys the next, hashnext and noprompt fields;
+also the windowtitle and windowhandle fields; gets a new back list). */
 
 init_buffer(currentbuffer, n, store_copystring(s), store_copystring(s), fid);
 
 currentbuffer->next = next;             /* restore */
+currentbuffer->hashnext = hashnext;
 currentbuffer->noprompt = noprompt;
 
 currentbuffer = NULL;                   /* de-select to inhibit save */
@@ -2,10 +2,10 @@
 *       The E text editor - 3rd incarnation      *
 *************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2023 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: February 2023 */
+/* This file last modified: October 2026 */
 
 
 /* This file contains code for obeying commands: Part III */
@@ -118,7 +118,9 @@ to the one required. The old number will have been main_nextbufferno-1, so
 reset that. */
 
 e_newbuffer(cmd);
+cmd_hashbuffer(currentbuffer, FALSE);
 currentbuffer->bufferno = cmd->arg2.value;
+cmd_hashbuffer(currentbuffer, TRUE);
 main_nextbufferno--;
 
 /* The new buffer will have been made current; revert to the
@@ -309,6 +311,7 @@ init_buffer(new, main_nextbufferno - 1, store_copystring(name),
   store_copystring(name), fid);
 new->next = main_bufferchain;
 main_bufferchain = new;
+cmd_hashbuffer(new, TRUE);
 init_selectbuffer(new);
 return done_continue;
 }
@@ -424,7 +427,7 @@ int
 e_plllr(cmdstr *cmd)
 {
 cursor_col = (cmd->misc == abe_b)? 0 :
-  line_charcount(main_current->text, main_current->len);
+  line_column(main_current, main_current->len);
 return done_continue;
 }
 
@@ -450,8 +453,7 @@ else
   p->flags = 0;
   p->name = store_copystring(name);
   p->body = cmd_copyblock((cmdblock *)(cmd->arg2.cmds));
-  p->next = main_proclist;
-  main_proclist = p;
+  cmd_addproc(p);
   return done_continue;
   }
 }
@@ -487,6 +489,25 @@ return done_continue;
 
 
 
+/*************************************************
+*             The REDO command                   *
+*************************************************/
+
+int
+e_redo(cmdstr *cmd)
+{
+(void)cmd;
+if (!undo_undoredo(FALSE))
+  {
+  error_moan(76, "redo");
+  return done_error;
+  }
+cmd_refresh = TRUE;
+return done_continue;
+}
+
+
+
 /*************************************************
 *             The REFRESH command                *
 *************************************************/
@@ -535,17 +556,21 @@ return done_continue;
 *             The REPEAT command                 *
 *************************************************/
 
+/* A non-empty body checks for interruption before each of its commands, so
+an explicit check is needed here only when the body is empty. */
+
 int
 e_repeat(cmdstr *cmd)
 {
 int yield = done_loop;
+cmdstr *body = cmd->arg1.cmds;
 while (yield == done_loop)
   {
   yield = done_continue;
   while (yield == done_continue)
     {
-    if (main_interrupted(ci_loop)) return done_error;
-    yield = cmd_obeyline(cmd->arg1.cmds);
+    if (body == NULL && main_interrupted(ci_loop)) return done_error;
+    yield = cmd_obeyline(body);
     }
   if (yield == done_loop || yield == done_break)
     {
@@ -2,10 +2,10 @@
 *       The E text editor - 3rd incarnation      *
 *************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2025 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: March 2025 */
+/* This file last modified: October 2026 */
 
 
 /* This file contains code for obeying commands: Part IV */
@@ -71,6 +71,12 @@ if (name == NULL || name[0] == 0)
   error_moan(59, currentbuffer->bufferno);
   return done_error;
   }
+
+/* A save that is still running in the background may be writing the same
+file. Opening the file truncates it, and the earlier process would carry on
+writing at its old offset, so wait for any such saves to finish first. */
+
+if (main_saving) file_savecheck(TRUE);
 fid = sys_fopen(name, US"w");
 
 if (main_screenmode) error_printf("Writing %s\n", alias);
@@ -81,6 +87,12 @@ if (fid == NULL)
   return done_error;
   }
 
+/* If WRITE is overwriting the buffer's own file, a journal based on that file
+is no longer usable. A new one is started with a copy of the buffer. */
+
+if (!saveflag && main_filename != NULL && Ustrcmp(name, main_filename) == 0)
+  journal_end(currentbuffer);
+
 /* If new name, reset the buffer's files (cf NAME) */
 
 if (changename)
@@ -94,6 +106,53 @@ if (changename)
   main_drawgraticules |= dg_bottom;
   }
 
+/* Give back any spare room in the lines' text before a background process takes
+its snapshot of them. */
+
+line_trimroom(line, last);
+
+/* In screen mode, except for binary files, the file is written by a
+background process, which has a snapshot of the buffer, so that editing can
+continue. The result is reported later. If the process cannot be started, the
+file is written here. */
+
+if (main_screenOK && !main_binary)
+  {
+  int pid = sys_bgstart();
+
+  if (pid == 0)
+    {
+    int rc = 0;
+    while ((line->flags & lf_eof) == 0)
+      {
+      if (file_writeline(line, fid) < 0)
+        {
+        rc = (errno == 0)? EIO : errno;   /* LCOV_EXCL_LINE */
+        break;                            /* LCOV_EXCL_LINE */
+        }
+      if (line == last) break;
+      line = line->next;
+      }
+    if (fclose(fid) != 0 && rc == 0) rc = errno;
+    sys_bgend(rc);
+    }
+
+  if (pid > 0)
+    {
+    fclose(fid);
+    file_savestart(pid, saveflag? currentbuffer : NULL, alias);
+    if (saveflag)
+      {
+      main_filechanged = FALSE;
+      currentbuffer->changed = FALSE;
+      currentbuffer->saved = TRUE;
+      journal_savestart(currentbuffer, pid);
+      }
+    main_nowait = TRUE;
+    return done_continue;
+    }
+  }
+
 /* Now write the file */
 
 savealias = main_filealias;
@@ -124,6 +183,7 @@ if (saveflag)
     main_filechanged = FALSE;
     currentbuffer->changed = FALSE;
     currentbuffer->saved = TRUE;
+    journal_saved(currentbuffer);
     }
   }
 
@@ -163,6 +223,18 @@ switch (cmd->misc)
   case set_newcommentstyle:
   main_oldcomment = FALSE;
   break;
+
+  /* The limit is given in kilobytes. Setting zero turns off recording, so
+  discard any existing journals. */
+
+  case set_undolimit:
+  main_undolimit = (size_t)(cmd->arg1.value) * 1024;
+  if (main_undolimit == 0)
+    {
+    for (bufferstr *b = main_bufferchain; b != NULL; b = b->next)
+      undo_discard(b);
+    }
+  break;
   }
 return done_continue;
 }
@@ -520,12 +592,18 @@ switch (cmd->misc)
     if (main_screenmode || allsettings)
       error_printf("splitscrollrow:   %3d\n", main_ilinevalue);
     error_printf("tab setting:  %s\n", tabsetting());
+    error_printf("undolimit:        %luK\n",
+      (unsigned long int)(main_undolimit/1024));
     if (!main_screenmode || allsettings)
       error_printf("verify:           %s\n", main_verify? " on" : "off");
     error_printf("warn:             %s\n", main_warnings? " on" : "off");
     error_printf("widechars:        %s\n", allow_wide? " on" : "off");
     }
   break;
+
+  case show_stats:
+  debug_stats(FALSE);
+  break;
   }
 
 return done_wait;    /* indicate output produced */
@@ -719,7 +797,7 @@ if (main_undelete != NULL)
     if (main_undelete->len <= 0)    /* Used up all deleted characters */
       {
       linestr *next = main_undelete->next;
-      store_free(main_undelete->text);
+      store_freetext(main_undelete->text);
       store_free(main_undelete);
       main_undeletecount--;
       main_undelete = next;
@@ -746,6 +824,7 @@ if (main_undelete != NULL)
     main_current = new;          /* Put cursor back on inserted line */
     cursor_col = 0;
     main_linecount++;
+    undo_inserted(new, new, 1);
     if (main_screenOK) scrn_hint(sh_insert, 1, NULL);
     cmd_refresh = TRUE;
     }
@@ -758,6 +837,25 @@ return done_continue;
 
 
 
+/*************************************************
+*             The UNDO command                   *
+*************************************************/
+
+int
+e_undo(cmdstr *cmd)
+{
+(void)cmd;
+if (!undo_undoredo(TRUE))
+  {
+  error_moan(76, "undo");
+  return done_error;
+  }
+cmd_refresh = TRUE;
+return done_continue;
+}
+
+
+
 /*************************************************
 *            The UNFORMAT command                *
 *************************************************/
@@ -806,6 +904,11 @@ e_w(cmdstr *cmd)
 int count = 0;
 bufferstr *thisbuffer = currentbuffer;
 
+/* Wait for any saves in the background to finish; if any fail, their buffers
+are marked as changed again. */
+
+if (main_saving) file_savecheck(TRUE);
+
 /* Warn if data in the cut buffer has not been pasted; prompt for permission to
 continue (if non-interactive, answer will always be 'yes'). */
 
@@ -921,7 +1024,8 @@ return done_continue;
 *************************************************/
 
 /* This function is also called by UNTIL -- a switch in the command block
-distinguishes. The absence of a search expression means "test for eof". */
+distinguishes. The absence of a search expression means "test for eof". As for
+REPEAT, a non-empty body checks for interruption itself. */
 
 int
 e_while(cmdstr *cmd)
@@ -931,6 +1035,7 @@ int misc = cmd->misc;
 BOOL oldeoftrap = cmd_eoftrap;
 BOOL prompt = (misc & if_prompt) != 0;
 sestr *se = ((cmd->flags & cmdf_arg1) == 0)? NULL : cmd->arg1.se;
+cmdstr *body = cmd->arg2.cmds;
 
 cmd_eoftrap = (se == NULL) &&
               (misc & (if_mark | if_eol | if_sol | if_sof)) == 0;
@@ -941,7 +1046,7 @@ while (yield == done_loop)
   while (yield == done_continue)
     {
     int match;
-    if (main_interrupted(ci_loop)) return done_error;
+    if (body == NULL && main_interrupted(ci_loop)) return done_error;
 
     if (prompt)
       match = cmd_yesno("%s", cmd->arg1.string->text)? MATCH_OK : MATCH_FAILED;
@@ -968,7 +1073,7 @@ while (yield == done_loop)
       }
     if (misc >= if_unless) match = (match == MATCH_OK)? MATCH_FAILED : MATCH_OK;
 
-    if (match == MATCH_OK) yield = cmd_obeyline(cmd->arg2.cmds); else break;
+    if (match == MATCH_OK) yield = cmd_obeyline(body); else break;
     }
 
   if (yield == done_loop || yield == done_break)
@@ -2,10 +2,10 @@
 *       The E text editor - 3rd incarnation      *
 *************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2024 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: September 2024 */
+/* This file last modified: October 2026 */
 
 
 /* This file contains code for handling errors */
@@ -127,11 +127,25 @@ static error_struct error_data[] = {
 /* 70-74 */
 { rc_serious,  FALSE, US"Internal failure: buffer %d not found in buffer list\n" },
 { rc_serious,  FALSE, US"Environment variable NETABS value \"%s\" is invalid\n" },
-{ rc_disaster, FALSE, US"\"-withkeys\" is not valid in line-by-line mode\n" },
+{ rc_disaster, FALSE, US"\"%s\" is not valid in line-by-line mode\n" },
 { rc_serious,  FALSE, US"\"%s\" in -withkeys file is not a known keyname - NE abandoned\n" },
 { rc_disaster, FALSE, US"Internal failure: -withkeys name \"%s\": Pkey code %d not found - NE abandoned\n" },
 /* 75-79 */
-{ rc_warning,  FALSE, US"Warning: The 'i' qualifier has no effect without 'r'\n" }
+{ rc_warning,  FALSE, US"Warning: The 'i' qualifier has no effect without 'r'\n" },
+{ rc_serious,  FALSE, US"There is nothing to %s\n" },
+{ rc_warning,  FALSE, US"Warning: Change is too large for the undo limit - undo information discarded\n" },
+{ rc_serious,  FALSE, US"Internal failure - undo information was inconsistent and has been discarded\n" },
+/* 79-81 */
+{ rc_warning,  FALSE, US"Warning: Recovery journal %s exists - changes to %s are not being journalled (use -recover to recover it)\n" },
+{ rc_warning,  FALSE, US"Warning: Failed to write recovery journal %s: %s - journalling stopped\n" },
+{ rc_serious,  FALSE, US"Cannot recover %s from %s: %s\n" },
+/* 82-84 */
+{ rc_disaster, FALSE, US"-batch requires a -with command file\n" },
+{ rc_disaster, FALSE, US"%s is valid only with -batch\n" },
+{ rc_disaster, FALSE, US"%s cannot be used with -batch\n" },
+/* 85-86 */
+{ rc_disaster, FALSE, US"-headless needs a terminal type (TERM) that supports screen editing\n" },
+{ rc_disaster, FALSE, US"With -batch, -to must name an existing directory: %s is not a directory\n" }
 };
 
 #define error_maxerror (int)(sizeof(error_data)/sizeof(error_struct))
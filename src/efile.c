@@ -2,18 +2,21 @@
 *       The E text editor - 3rd incarnation      *
 *************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2023 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: February 2023 */
+/* This file last modified: October 2026 */
 
 
 /* This file contains code for handling input and output */
 
 #include "ehdr.h"
+#include "shdr.h"
 
 #define BUFFGETSIZE 1024
 
+static savestr *saves = NULL;
+
 
 
 /*************************************************
@@ -97,7 +100,11 @@ for (int i = 0; i < 16; i++)
       }
     sprintf(CS p, "   ");
     }
-  else sprintf(CS p, "%02x ", c);
+  else
+    {
+    sprintf(CS p, "%02x ", c);
+    main_stats.file_read++;
+    }
   p += 3;
   if (i == 7) *p++ = ' ';
   cc[i] = isprint(c)? c : '.';
@@ -121,7 +128,7 @@ NULL, the input is read and converted to hex by calling the above function. In
 non-binary mode, or if binoffset is NULL (indicating reading from a command
 file) the next line is read as is. In this case we get a line buffer of
 large(ish) size, and free off the end of it if possible. When a line is very
-long, we have to copy it into a longer buffer.
+long, we have to copy it into a buffer twice the size.
 
 Arguments:
   f           the file to read from
@@ -134,8 +141,9 @@ Returns:      a line structure (if EOF, it's set as an EOF line)
 linestr *
 file_nextline(FILE *f, size_t *binoffset)
 {
-BOOL eof, tabbed;
+BOOL eof, tabbed, ascii, plain;
 size_t length, maxlength;
+size_t bytes = 0;
 linestr *line;
 uschar *s;
 
@@ -147,6 +155,7 @@ if (main_binary && binoffset != NULL) return file_nextbinline(f, binoffset);
 /* Not a binary read */
 
 eof = tabbed = FALSE;
+ascii = plain = TRUE;
 length = 0;
 maxlength = BUFFGETSIZE;
 line = store_getlbuff(BUFFGETSIZE);
@@ -158,25 +167,28 @@ for (;;)
   int need;
   int c = fgetc(f);
 
-  if (c == '\n') break;
   if (c == EOF)
     {
     if (length == 0 || ferror(f)) eof = TRUE;
     break;
     }
+  bytes++;
+  if (c == '\n') break;
 
   need = (c == '\t' && main_tabin)? 8 - length % 8 : 1;  /* Space needed */
 
-  /* If the current buffer is full, extend the line up to MAX_LINELENGTH. If we
-  hit the absolute maximum, end the line, which has the effect of splitting it
-  into two. As well as at other times, this function is called during
-  initialization, when loading a file named on the command line. At that point,
-  main_initialized is FALSE. We temporarily make it TRUE so that error_moan()
-  does not make this a hard error. */
+  /* If the current buffer is full, extend it. The size is doubled each time,
+  so that reading a very long line does not copy it over and over again; the
+  spare room is given back when the line is complete. A line is split only if
+  it reaches MAX_LINELENGTH, which is far more than any real file needs. As
+  well as at other times, this function is called during initialization, when
+  loading a file named on the command line. At that point, main_initialized is
+  FALSE. We temporarily make it TRUE so that error_moan() does not make this a
+  hard error. */
 
   if (length > maxlength - need)
     {
-    if (length > MAX_LINELENGTH)
+    if (length > MAX_LINELENGTH - need)
       {
       /* LCOV_EXCL_START */
       BOOL temp = main_initialized;
@@ -189,20 +201,21 @@ for (;;)
 
     /* Extend the line buffer */
 
-    newtext = store_get(length + BUFFGETSIZE);
+    maxlength *= 2;
+    if (maxlength > MAX_LINELENGTH) maxlength = MAX_LINELENGTH;
+    newtext = store_gettext(maxlength);
     if (newtext == NULL)
       {
       /* LCOV_EXCL_START */
-      error_moan(1, length+BUFFGETSIZE);
+      error_moan(1, maxlength);
       break;
       /* LCOV_EXCL_STOP */
       }
 
     memcpy(newtext, line->text, length);
-    store_free(line->text);
+    store_freetext(line->text);
     line->text = newtext;
     s = line->text + length;
-    maxlength += BUFFGETSIZE;
     }
 
   /* Now have room for the byte or tab spaces */
@@ -218,23 +231,34 @@ for (;;)
     }
   else
     {
+    if (c >= 0x80)
+      {
+      plain = FALSE;
+      if (c >= 0xc0) ascii = FALSE;
+      }
     *s++ = c;
     length++;
     }
   }
 
-/* Line is complete */
+/* Line is complete. Only lines of files count as file bytes; command lines
+are read with binoffset NULL. Noting a line that has no multibyte characters,
+and whether a line is valid UTF-8, saves scanning it later. */
 
+if (binoffset != NULL) main_stats.file_read += bytes;
 line->len = length;
 if (eof) line->flags |= lf_eof;
 if (tabbed) line->flags |= lf_tabs;
+if (ascii) line->flags |= lf_ascii;
+if (plain) line->flags |= lf_utf8;
+  else if (allow_wide) (void)line_isutf8(line);
 
 /* Free up unwanted memory at end of the buffer, or free the whole buffer if
 this is an empty line. */
 
-if (length > 0) store_chop(line->text, length); else
+if (length > 0) store_choptext(line->text, length); else
   {
-  store_free(line->text);
+  store_freetext(line->text);
   line->text = NULL;
   }
 
@@ -243,6 +267,316 @@ return line;
 
 
 
+/*************************************************
+*       Read more of a file being loaded         *
+*************************************************/
+
+/* When files named on the command line are loaded for screen editing, only the
+first part of each is read by init_buffer(). This function reads more lines,
+inserting them before the end-of-file line that was added to the part already
+read. The buffer need not be the current one; if it is, the line count and
+number are in global variables. When the end of the file is reached, it is
+closed.
+
+Arguments:
+  buffer     the buffer
+  count      the maximum number of lines to read
+
+Returns:     nothing
+*/
+
+void
+file_loadmore(bufferstr *buffer, int count)
+{
+BOOL current = buffer == currentbuffer;
+linestr *bottom = current? main_bottom : buffer->bottom;
+usint linecount = current? main_linecount : (usint)buffer->linecount;
+int imax = current? main_imax : buffer->imax;
+
+while (count-- > 0)
+  {
+  linestr *line = file_nextline(buffer->loadfid, &buffer->binoffset);
+
+  /* At the end of the file, the end-of-file line that was added stays in
+  place, as it may be displayed or remembered. If a read error caused the line
+  to have data, that is moved into it. */
+
+  if ((line->flags & lf_eof) != 0)
+    {
+    if (line->len > 0)
+      {
+      bottom->text = line->text;   /* LCOV_EXCL_LINE */
+      bottom->len = line->len;     /* LCOV_EXCL_LINE */
+      bottom->flags &= ~lf_chbits; /* LCOV_EXCL_LINE */
+      }
+    store_free(line);
+    journal_loaded(buffer, buffer->loadfid);
+    fclose(buffer->loadfid);
+    buffer->loadfid = NULL;
+    break;
+    }
+
+  /* The new line takes over the end-of-file line's number. There is always at
+  least one line before the end-of-file line while a file is being read. */
+
+  line->key = bottom->key;
+  bottom->key = ++imax;
+  line->prev = bottom->prev;
+  line->next = bottom;
+  bottom->prev->next = line;
+  bottom->prev = line;
+  linecount++;
+  }
+
+if (current)
+  {
+  main_linecount = linecount;
+  main_imax = imax;
+  }
+else
+  {
+  buffer->linecount = linecount;
+  buffer->imax = imax;
+  }
+
+/* Check whether any file is still being read. */
+
+if (buffer->loadfid == NULL)
+  {
+  main_loading = FALSE;
+  for (bufferstr *b = main_bufferchain; b != NULL; b = b->next)
+    if (b->loadfid != NULL) main_loading = TRUE;
+  }
+}
+
+
+
+/*************************************************
+*     Show a message while waiting for keys      *
+*************************************************/
+
+/* This is used for reporting on work done in the background. The message line
+is overwritten and the cursor is put back where it was.
+
+Argument:  the message, or NULL to wipe out the line
+Returns:   nothing
+*/
+
+static void
+showmessage(uschar *s)
+{
+int x = s_x();
+int y = s_y();
+s_selwindow(message_window, 0, 0);
+if (s != NULL) s_printf("%s", s);
+s_eraseright();
+s_selwindow(first_window, x, y);
+s_flush();
+}
+
+
+
+/*************************************************
+*         Show progress while loading            *
+*************************************************/
+
+/* The number of lines read so far is shown in the message line while the
+current buffer is being loaded, and wiped out when it is complete.
+
+Argument:  TRUE if loading of the current buffer is complete
+Returns:   nothing
+*/
+
+static void
+showprogress(BOOL done)
+{
+static BOOL shown = FALSE;
+uschar buff[40];
+
+if (!main_screenOK || (done && !shown)) return;
+if (done)
+  {
+  showmessage(NULL);
+  shown = FALSE;
+  }
+else
+  {
+  sprintf(CS buff, "%d lines read so far", main_linecount - 1);
+  showmessage(buff);
+  shown = TRUE;
+  }
+}
+
+
+
+/*************************************************
+*     Read more of a file in the background      *
+*************************************************/
+
+/* This is called from the keystroke loop while no keystroke is waiting. It
+reads the next chunk of the current buffer's file, if there is one, or else of
+another buffer's. If the end of the current buffer is on the screen, the screen
+is updated.
+
+Arguments:  none
+Returns:    nothing
+*/
+
+void
+file_loadnext(void)
+{
+static int chunks = 0;
+bufferstr *buffer = currentbuffer;
+
+if (buffer->loadfid == NULL)
+  {
+  for (buffer = main_bufferchain; buffer != NULL; buffer = buffer->next)
+    if (buffer->loadfid != NULL) break;
+  if (buffer == NULL) return;     /* LCOV_EXCL_LINE */
+  file_loadmore(buffer, LOAD_CHUNK);
+  return;
+  }
+
+file_loadmore(buffer, LOAD_CHUNK);
+
+for (usint i = 0; i <= window_depth; i++)
+  {
+  if (window_vector[i] == main_bottom)
+    {
+    scrn_display();
+    break;
+    }
+  }
+
+if (buffer->loadfid == NULL) showprogress(TRUE);
+  else if ((chunks++ & 31) == 0) showprogress(FALSE);
+}
+
+
+
+/*************************************************
+*        Read the rest of a file or files        *
+*************************************************/
+
+/* This is called when the whole of a buffer is needed, for example, before
+obeying a command line.
+
+Argument:  the buffer, or NULL for all buffers that are being loaded
+Returns:   nothing
+*/
+
+void
+file_loadrest(bufferstr *buffer)
+{
+if (buffer == NULL)
+  {
+  for (buffer = main_bufferchain; buffer != NULL; buffer = buffer->next)
+    if (buffer->loadfid != NULL) file_loadrest(buffer);
+  return;
+  }
+
+while (buffer->loadfid != NULL)
+  {
+  file_loadmore(buffer, 32 * LOAD_CHUNK);
+  if (buffer == currentbuffer) showprogress(buffer->loadfid == NULL);
+  }
+}
+
+
+
+/*************************************************
+*        Record a save in the background         *
+*************************************************/
+
+/* This is called when a process has been started to write a file.
+
+Arguments:
+  pid        the process
+  buffer     the buffer to be marked as changed if the save fails, or NULL
+  name       the file name, for messages
+
+Returns:     nothing
+*/
+
+void
+file_savestart(int pid, bufferstr *buffer, uschar *name)
+{
+savestr *save = store_Xget(sizeof(savestr));
+save->next = saves;
+save->buffer = buffer;
+save->name = store_copystring(name);
+save->pid = pid;
+saves = save;
+main_saving = TRUE;
+}
+
+
+
+/*************************************************
+*        Check on saves in the background        *
+*************************************************/
+
+/* This is called from the keystroke loop while no keystroke is waiting, in
+which case the result of each save that has finished is shown in the message
+line. It is also called to wait for all saves to finish, for example, before
+the W command checks which buffers have changed, in which case only failures
+are reported, as normal error messages. When a save has failed, the buffer is
+marked as changed again, if it still exists. The buffer's crash-recovery
+journal is told the outcome.
+
+Argument:  TRUE to wait for all saves to finish
+Returns:   nothing
+*/
+
+void
+file_savecheck(BOOL wait)
+{
+savestr **sp = &saves;
+
+while (*sp != NULL)
+  {
+  savestr *save = *sp;
+  int rc = sys_bgcheck(save->pid, wait);
+
+  if (rc < 0)
+    {
+    sp = &(save->next);
+    continue;
+    }
+
+  for (bufferstr *b = main_bufferchain; b != NULL; b = b->next)
+    {
+    if (b != save->buffer) continue;
+    journal_savedone(b, save->pid, rc == 0);
+    if (rc == 0) continue;
+    b->saved = FALSE;
+    if (b == currentbuffer) main_filechanged = TRUE; else b->changed = TRUE;
+    }
+
+  if (wait || !main_screenOK)
+    {
+    if (rc != 0) error_moan(37, save->name, strerror(rc));
+    }
+  else
+    {
+    uschar buff[FNAME_BUFFER_SIZE + 100];
+    if (rc == 0) sprintf(CS buff, "%.*s written", FNAME_BUFFER_SIZE, save->name);
+      else sprintf(CS buff, "** I/O error while writing file \"%.*s\": %s",
+        FNAME_BUFFER_SIZE, save->name, strerror(rc));
+    showmessage(buff);
+    if (rc != 0) sys_beep();
+    }
+
+  *sp = save->next;
+  store_free(save->name);
+  store_free(save);
+  }
+
+main_saving = saves != NULL;
+}
+
+
+
 /*************************************************
 *           Write a line's characters            *
 *************************************************/
@@ -305,6 +639,7 @@ if (main_binary)
       }
 
     fputc(cc, f);
+    main_stats.file_written++;
     }
 
   return ok? 1 : 0;
@@ -339,21 +674,28 @@ if (main_tabout || (line->flags & lf_tabs) != 0)
         /* Found suitable string - use tab(s) and skip spaces */
         c = '\t';
         i = k - 1;
-        for (; n > 8; n -= 8) fputc('\t', f);
+        for (; n > 8; n -= 8)
+          {
+          fputc('\t', f);
+          main_stats.file_written++;
+          }
         }
       }
     fputc(c, f);
+    main_stats.file_written++;
     }
   }
 
 /* Untabbed line -- optimize, but don't write if len == 0 because p may be
 NULL, and ASAN complains. */
 
-else if (len > 0 && fwrite(p, 1, len, f)){};  /* Avoid compiler warning */
+else if (len > 0 && fwrite(p, 1, len, f))
+  main_stats.file_written += len;
 
 /* Add final LF */
 
 fputc('\n', f);
+main_stats.file_written++;
 
 /* Check that the line was successfully written, and yield the result. */
 
@@ -391,6 +733,8 @@ else if ((f = sys_fopen(name, US"w")) == NULL)
   return FALSE;
   }
 
+line_trimroom(line, NULL);
+
 while ((line->flags & lf_eof) == 0)
   {
   int rc = file_writeline(line, f);
@@ -2,10 +2,10 @@
 *       The E text editor - 3rd incarnation      *
 *************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2024 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: September 2024 */
+/* This file last modified: October 2026 */
 
 
 /* This file contains all the global variables. */
@@ -28,11 +28,13 @@ FILE *cmdin_fid = NULL;
 FILE *msgs_fid;
 FILE *kbd_fid;
 FILE *withkey_fid = NULL;
+FILE *trace_fid = NULL;
 usint withkey_sleep = 0;
 
 BOOL    allow_wide = FALSE;
 
 uschar *arg_from_name = NULL;         /* Names on command line */
+uschar *arg_headless_name = NULL;
 uschar *arg_to_name = NULL;
 uschar *arg_ver_name = NULL;
 uschar *arg_with_name = NULL;
@@ -77,6 +79,8 @@ BOOL     error_werr = FALSE;
 
 filewritstr *files_written = NULL;
 
+BOOL     init_cacheable = FALSE;
+
 uschar   key_codes[256];
 usint    key_controlmap;
 usint    key_functionmap;
@@ -96,7 +100,7 @@ linestr *main_undelete;
 
 bufferstr *main_bufferchain = NULL;
 backstr   *main_backlist;
-procstr   *main_proclist = NULL;
+procstr   *main_proclist[proc_hashsize];
 
 BOOL    main_appendswitch = FALSE;
 BOOL    main_attn = TRUE;
@@ -106,9 +110,10 @@ usint   main_backtop = 0;
 usint   main_backregionsize = 12;
 BOOL    main_backupfiles = FALSE;
 BOOL    main_binary = FALSE;
-int     main_cicount = 0;
+volatile sig_atomic_t main_cicheck = FALSE;
 BOOL    main_detrail_output = FALSE;
 BOOL    main_done = FALSE;
+BOOL    main_dumpstats = FALSE;
 int     main_drawgraticules;
 BOOL    main_eightbit = FALSE;
 uschar *main_einit = NULL;
@@ -124,7 +129,9 @@ int     main_imax;
 int     main_imin;
 BOOL    main_initialized = FALSE;
 BOOL    main_interactive = TRUE;
+BOOL    main_journal = FALSE;
 BOOL    main_leave_message = FALSE;
+BOOL    main_loading = FALSE;
 usint   main_linecount = 0;
 BOOL    main_logging = FALSE;
 int     main_nextbufferno;
@@ -138,19 +145,23 @@ BOOL    main_overstrike = FALSE;
 BOOL    main_pendnl = FALSE;
 int     main_rc = 0;                  /* The final return code */
 BOOL    main_readonly = FALSE;
+BOOL    main_recover = FALSE;
 BOOL    main_repaint;
 usint   main_rmargin = 79;            /* Default for line-by-line */
+BOOL    main_saving = FALSE;
 BOOL    main_screenmode = TRUE;
 BOOL    main_screenOK = FALSE;
 BOOL    main_screensuspended = FALSE;
 BOOL    main_selectedbuffer;
 BOOL    main_shownlogo = FALSE;       /* FALSE if need to show logo on error */
+statsstr main_stats;
 size_t  main_storetotal = 0;          /* Total store used */
 BOOL    main_tabflag = FALSE;
 BOOL    main_tabin = FALSE;
 BOOL    main_tabout = FALSE;
 uschar *main_tabs = US"tabs";
 int     main_undeletecount = 0;
+size_t  main_undolimit = 8192*1024;   /* Undo memory per buffer */
 BOOL    main_utf8terminal = FALSE;
 int     main_vcursorscroll = 1;
 int     main_vmousescroll = 1;
@@ -199,6 +210,8 @@ int   sys_openfail_reason = of_other;
 
 int   topbit_minimum = 160;         /* minimum top-bit uschar */
 
+BOOL  undo_suspended = FALSE;      /* Not recording changes */
+
 uschar *version_copyright;          /* Copyright string */
 uschar  version_date[20];           /* Identity date */
 uschar *version_string;             /* Identity of program version */
@@ -419,6 +432,8 @@ ka_dp,       /* F21 */  /* Because DELETE does this in xterm */
 29,          /* F29 */
 30};         /* F30 */
 
+int key_tablesize = sizeof(key_table)/sizeof(short int);
+
 
 /* Table for actual control keys that are not changeable by the user. We have
 this here so that it is next to the previous one (for convenience). The only
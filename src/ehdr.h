@@ -2,10 +2,10 @@
 *             The E text editor - 3rd incarnation          *
 ***********************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2024 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: September 2024 */
+/* This file last modified: October 2026 */
 
 
 /* This is the main header file, imported by all other sources. */
@@ -31,6 +31,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stddef.h>  /* for SunOS' benefit (saves NULL redefined warnings) */
+#include <time.h>
 #include <unistd.h>
 
 
@@ -41,11 +42,27 @@
 
 #define BIGNUMBER   0x7fffffff
 #define MAX_RMARGIN    1000000
-#define MAX_LINELENGTH  100000
+#define MAX_LINELENGTH 0x40000000  /* offsets within a line are ints */
 #define MAX_ERRORS          50    /* Max errors without an interaction */
 
 #define MAX_FROM            50    /* max from files */
+#define LOAD_CHUNK         256    /* lines read at once in the background */
+#define JOURNAL_IDLE       500    /* ms without keystrokes before journalling */
 #define BLOCK_SCROLL_MIN     6    /* minimum block size for scroll adjust */
+#define CHARINDEX_MIN      256    /* shortest line that gets a character index */
+#define CHARINDEX_STEP      64    /* characters between index entries */
+#define CHARINDEX_CACHE      8    /* number of indexes kept */
+#define LAYOUT_MIN         256    /* shortest line that gets a column layout */
+#define LAYOUT_STEP         64    /* characters between layout entries */
+#define LAYOUT_CACHE         8    /* number of layouts kept */
+#define FORMAT_KEEP      16384    /* largest FORMAT buffer kept after use */
+#define BUFFER_HASH        256    /* size of buffer number hash table */
+#define CI_INTERVAL         50    /* milliseconds between interrupt checks */
+
+/* The spare room given to the text of a line that is being edited, so that
+characters can be inserted without copying the whole line each time. */
+
+#define TEXT_ROOM(len)  ((len)/4 + 16)
 
 #define MATCH_OK             0    /* returns from cmd_matchxx functions */
 #define MATCH_FAILED       (+1)
@@ -67,6 +84,7 @@
 #define FNAME_BUFFER_SIZE 4096    /* file names can be long */
 
 #define back_size           20    /* number of "back" reference regions */
+#define proc_hashsize      256    /* procedure hash table size; power of 2 */
 
 #define mac_skipspaces(a)  while (*a == ' ') a++
 
@@ -151,19 +169,21 @@ enum { cuttype_text, cuttype_rect };
 enum { show_ckeys = 1, show_fkeys, show_xkeys, show_allkeys,
   show_keystrings, show_buffers, show_wordcount, show_version,
   show_actions, show_commands, show_wordchars, show_settings,
-  show_allsettings };
+  show_allsettings, show_stats };
 
 enum { abe_a, abe_b, abe_e };
 
 enum { cbuffer_c, cbuffer_cd };
 
 enum { set_autovscroll = 1, set_autovmousescroll, set_splitscrollrow,
-  set_oldcommentstyle, set_newcommentstyle };
+  set_oldcommentstyle, set_newcommentstyle, set_undolimit };
 
 enum { debug_crash = 1, debug_exceedstore, debug_nullline, debug_baderror };
 
 enum { detrail_buffer, detrail_output };
 
+enum { trace_execute, trace_display, trace_flush, trace_phases };
+
 enum { backup_files };
 
 enum { ci_move, ci_type, ci_read, ci_cmd, ci_delete, ci_scan, ci_loop };
@@ -233,6 +253,37 @@ number of subsequent bytes must have their top two bits set to 0x80. */
       } \
     }
 
+/* Get the next character from text that is known to be valid UTF-8,
+advancing the pointer. */
+
+#define GETUTF8INC(c, ptr) \
+  c = *ptr++; \
+  if (c >= 0xc0) \
+    { \
+    int gcaa = utf8_table4[c & 0x3f];  /* Number of additional bytes */ \
+    int gcss = 6*gcaa; \
+    c = (c & utf8_table3[gcaa]) << gcss; \
+    while (gcaa-- > 0) \
+      { \
+      gcss -= 6; \
+      c |= (*ptr++ & 0x3f) << gcss; \
+      } \
+    }
+
+/* Get the number of screen cells that a character uses. Only a double-width
+character on a UTF-8 terminal uses two; a character that cannot be displayed is
+replaced by the substitution character, which uses one. */
+
+#define CHARCELLS(c) \
+  (((c) >= 256 && main_utf8terminal && ch_width(c) == 2)? 2 : 1)
+
+/* Test for an interruption. The flag is set by a timer while commands are
+being obeyed, and by the interrupt handler, so this is cheap enough to use for
+every line in a loop. The argument is one of the ci_xxx values, which records
+the kind of activity at each call, but it is not currently used. */
+
+#define main_interrupted(type) (main_cicheck? main_checkinterrupt() : FALSE)
+
 /* Advance over one character, given pointer */
 
 #define SKIPCHAR(ptr, eptr) \
@@ -298,18 +349,19 @@ extern FILE *cmdin_fid;                /* command input */
 extern FILE *msgs_fid;                 /* message ougput */
 extern FILE *kbd_fid;                  /* keyboard input */
 extern FILE *withkey_fid;              /* simulated keystroke data */
+extern FILE *trace_fid;                /* trace of keystrokes and commands */
 extern usint withkey_sleep;            /* simulated keystrokes sleep time */
 
 extern BOOL    allow_wide;             /* TRUE to recognized UTF-8 */
 
 extern uschar *arg_from_name;          /* Names on command line */
+extern uschar *arg_headless_name;
 extern uschar *arg_to_name;
 extern uschar *arg_ver_name;
 extern uschar *arg_with_name;
 
 extern bufferstr *currentbuffer;
 
-extern uschar ch_displayable[];        /* Table of screen-displayable chars */
 extern uschar ch_tab[];                /* Table for identifying char types */
 
 extern cmd_Cproc cmd_Cproclist[];      /* List of command compile functions */
@@ -357,6 +409,8 @@ extern BOOL    error_werr;             /* Force window-type error */
 
 extern filewritstr *files_written;     /* Chain of written file names */
 
+extern BOOL    init_cacheable;         /* Init file effects can be cached */
+
 extern uschar *key_actionnames[];
 extern int     key_actnamecount;       /* size of following table */
 extern keynamestr key_actnames[];      /* names for key actions */
@@ -368,6 +422,7 @@ extern keynamestr key_names[];         /* names for special keys */
 extern usint   key_specialmap[4];
 extern uschar *key_specialnames[];
 extern short int key_table[];
+extern int     key_tablesize;          /* size of key_table */
 
 extern sestr *last_se;                 /* last search expression */
 extern sestr *last_abese;              /* last se for abe */
@@ -390,9 +445,10 @@ extern usint   main_backtop;           /* topmost recorded position */
 extern usint   main_backregionsize;    /* size of "back" region */
 extern BOOL    main_backupfiles;       /* flag for auto-backing up */
 extern BOOL    main_binary;            /* handle lines as binary */
-extern int     main_cicount;           /* check interrupt count */
+extern volatile sig_atomic_t main_cicheck;  /* time to check for interrupt */
 extern BOOL    main_detrail_output;    /* detrail all output lines */
 extern BOOL    main_done;              /* job is finished */
+extern BOOL    main_dumpstats;         /* write statistics at exit */
 extern int     main_drawgraticules;    /* an option value */
 extern BOOL    main_eightbit;          /* display option */
 extern uschar *main_einit;             /* initializing file name */
@@ -406,6 +462,7 @@ extern uschar *main_filename;
 extern usint   main_hscrollamount;     /* left/right scroll value */
 extern int     main_ilinevalue;        /* boundary between up/down scroll */
 extern BOOL    main_interactive;       /* set if interactive */
+extern BOOL    main_journal;           /* keep crash-recovery journals */
 extern int     main_imax;              /* number of last line read */
 extern int     main_imin;              /* number of last insert */
 extern usint   main_linecount;         /* number of lines in current buffer */
@@ -415,6 +472,7 @@ extern BOOL    main_noinit;            /* don't obey init string */
 extern uschar *main_keystrings[];      /* variable keystrings */
 extern linestr *main_lastundelete;     /* last undelete structure */
 extern BOOL    main_leave_message;     /* leave msg in bottom window after cmds */
+extern BOOL    main_loading;           /* some file still being read */
 extern int     main_nextbufferno;      /* next number to use */
 extern int     main_oldcomment;        /* old-style comments flag */
 extern BOOL    main_nowait;            /* no wait before screen refresh */
@@ -422,22 +480,26 @@ extern BOOL    main_oneattn;           /* had one suppressed attention */
 extern uschar *main_opt;               /* the "opt" argument */
 extern BOOL    main_overstrike;
 extern BOOL    main_pendnl;            /* pending nl if more line-by-line output */
-extern procstr *main_proclist;         /* function chain */
+extern procstr *main_proclist[];       /* procedure hash chains */
 extern int     main_rc;                /* The final return code */
 extern BOOL    main_readonly;          /* Buffer is read only */
+extern BOOL    main_recover;           /* -recover was given */
 extern BOOL    main_repaint;           /* Force screen repaint after command */
 extern usint   main_rmargin;           /* current margin */
+extern BOOL    main_saving;            /* some save in the background */
 extern BOOL    main_screenmode;        /* true if full-screen operation */
 extern BOOL    main_screenOK;          /* screen mode and not suspended */
 extern BOOL    main_screensuspended;   /* screen temporarily suspended */
 extern BOOL    main_selectedbuffer;    /* true if buffer has changed */
 extern BOOL    main_shownlogo;         /* FALSE if need to show logo on error */
+extern statsstr main_stats;            /* counts of work done */
 extern BOOL    main_tabflag;           /* Flag tabbed input lines */
 extern BOOL    main_tabin;             /* the tabin option */
 extern BOOL    main_tabout;            /* the tabout option */
 extern uschar *main_tabs;              /* the default tabs text option */
 extern linestr *main_undelete;         /* first undelete structure */
 extern int     main_undeletecount;     /* count of lines */
+extern size_t  main_undolimit;         /* undo memory per buffer */
 extern BOOL    main_utf8terminal;      /* Terminal is UTF-8 */
 extern int     main_vcursorscroll;     /* Vertical scroll amount */
 extern int     main_vmousescroll;      /* Ditto, for mouse scroll */
@@ -487,6 +549,8 @@ extern int     sys_openfail_reason;    /* Reason for open failure */
 
 extern int     topbit_minimum;         /* lowest top-bit char */
 
+extern BOOL    undo_suspended;         /* not recording changes */
+
 extern const   int utf8_table3[];      /* Globally used UTF-8 table */
 extern const   uschar utf8_table4[];   /* Globally used UTF-8 table */
 
@@ -517,17 +581,25 @@ write "unsigned char *". */
 
 extern void    debug_printf(const char *, ...) PRINTF_FUNCTION;
 extern void    debug_screen(void);
+extern void    debug_stats(BOOL);
 extern void    debug_writelog(const char *, ...) PRINTF_FUNCTION;
 
+extern usint   ch_width(usint);
+
 extern BOOL    cmd_atend(void);
 extern cmdstr *cmd_compile(void);
 extern int     cmd_confirmoutput(uschar *, BOOL, BOOL, int, uschar **);
 extern void   *cmd_copyblock(cmdblock *);
 extern BOOL    cmd_emptybuffer(bufferstr *, uschar *);
 extern bufferstr *cmd_findbuffer(int);
+extern void    cmd_hashbuffer(bufferstr *, BOOL);
+extern void    cmd_addproc(procstr *);
+extern procstr *cmd_bindproc(cmdstr *);
+extern void    cmd_deleteproc(procstr *);
 extern BOOL    cmd_findproc(uschar *, procstr **);
 extern void    cmd_freeblock(cmdblock *);
 extern cmdstr *cmd_getcmdstr(int);
+extern cmdblock *cmd_loadblock(uschar **, uschar *);
 extern BOOL    cmd_joinline(BOOL);
 extern BOOL    cmd_makeCRE(qsstr *);
 extern int     cmd_matchqsR(qsstr *, linestr *, int);
@@ -543,6 +615,7 @@ extern int     cmd_readUstring(stringstr **);
 extern void    cmd_readword(void);
 extern linestr *cmd_ReChange(linestr *, uschar *, usint, BOOL, BOOL, BOOL);
 extern void    cmd_recordchanged(linestr *, int);
+extern void    cmd_saveblock(FILE *, cmdblock *);
 extern BOOL    cmd_yesno(const char *, ...) PRINTF_FUNCTION;
 
 extern void    crash_handler(int);
@@ -558,8 +631,13 @@ extern void    error_moanqse(int, sestr *);
 extern void    error_printf(const char *, ...) PRINTF_FUNCTION;
 extern void    error_printflush(void);
 
+extern void    file_loadmore(bufferstr *, int);
+extern void    file_loadnext(void);
+extern void    file_loadrest(bufferstr *);
 extern linestr *file_nextline(FILE *, size_t *);
 extern BOOL    file_save(uschar *);
+extern void    file_savecheck(BOOL);
+extern void    file_savestart(int, bufferstr *, uschar *);
 extern void    file_setwritten(uschar *);
 extern BOOL    file_written(uschar *);
 extern int     file_writeline(linestr *, FILE *);
@@ -568,6 +646,19 @@ extern void    init_buffer(bufferstr *, int, uschar *, uschar *, FILE *);
 extern BOOL    init_init(FILE *, uschar *, uschar *);
 extern void    init_selectbuffer(bufferstr *);
 
+extern BOOL    journal_complete(bufferstr *);
+extern void    journal_end(bufferstr *);
+extern void    journal_endall(void);
+extern void    journal_flush(void);
+extern void    journal_inserted(linestr *, linestr *, int);
+extern void    journal_loaded(bufferstr *, FILE *);
+extern BOOL    journal_recover(bufferstr *);
+extern void    journal_removed(linestr *, int, linestr *);
+extern void    journal_saved(bufferstr *);
+extern void    journal_savedone(bufferstr *, int, BOOL);
+extern void    journal_savestart(bufferstr *, int);
+extern void    journal_text(linestr *);
+
 extern void    key_handle_data(int);
 extern void    key_handle_function(int);
 extern BOOL    key_set(uschar *, BOOL);
@@ -575,6 +666,7 @@ extern void    key_setfkey(int, uschar *);
 
 extern int     line_bytecount(uschar *, int);
 extern usint   line_charcount(uschar *, usint);
+extern usint   line_column(linestr *, usint);
 extern int     line_checkabove(linestr *);
 extern linestr *line_concat(linestr *, int);
 extern linestr *line_copy(linestr *);
@@ -584,14 +676,17 @@ extern void    line_deletech(linestr *, int, int, BOOL);
 extern void    line_deletebytes(linestr *, int, int, BOOL);
 extern void    line_formatpara(BOOL);
 extern void    line_insertbytes(linestr *, int, int, uschar *, int, usint);
+extern BOOL    line_isutf8(linestr *);
 extern void    line_leftalign(linestr *, int, int *);
 extern usint   line_offset(linestr *, int);
 extern int     line_soffset(uschar *, uschar *, int);
 extern linestr *line_split(linestr *, usint);
+extern void    line_trimroom(linestr *, linestr *);
+extern void    line_unshare(linestr *);
 extern void    line_verify(linestr *, BOOL, BOOL);
 
 extern void    main_flush_interrupt(void);
-extern BOOL    main_interrupted(int);
+extern BOOL    main_checkinterrupt(void);
 
 extern BOOL    no_signal_traps;
 
@@ -600,13 +695,16 @@ extern int     ord2utf8(int, uschar *);
 
 extern int rdargs(int, char **, uschar *, arg_result *);
 
+extern usint   scrn_charcol(linestr *, usint);
 extern void    scrn_display(void);
 extern void    scrn_displayline(linestr *, int, int);
 extern void    scrn_hint(int, usint, linestr *);
 extern void    scrn_init(BOOL);
 extern void    scrn_invertchars(linestr *, int, int, int, int);
+extern BOOL    scrn_narrow(linestr *);
 extern void    scrn_rdline(BOOL, uschar *);
 extern void    scrn_restore(void);
+extern int     scrn_screencol(linestr *, usint);
 extern void    scrn_scrollby(int);
 extern void    scrn_setsize(void);
 extern void    scrn_suspend(void);
@@ -615,6 +713,7 @@ extern void    scrn_windows(void);
 extern int     setup_dbuffer(bufferstr *);
 
 extern void    store_chop(void *, size_t);
+extern void    store_choptext(uschar *, size_t);
 extern void   *store_copy(void *);
 extern linestr *store_copyline(linestr *);
 extern uschar *store_copystring(uschar *);
@@ -622,23 +721,48 @@ extern uschar *store_copystring2(uschar *, uschar *);
 extern void    store_free(void *);
 extern void    store_freequeuecheck(void);
 extern void    store_free_all(void);
+extern void    store_freetext(uschar *);
 extern void   *store_get(size_t);
 extern void   *store_getlbuff(size_t);
+extern uschar *store_gettext(size_t);
 extern void    store_init(void);
+extern uschar *store_sharetext(uschar *);
+extern BOOL    store_textshared(uschar *);
+extern size_t  store_textsize(uschar *);
 extern void   *store_Xget(size_t);
+extern uschar *store_Xgettext(size_t);
 
 extern uschar *sys_argstring(uschar *);
 extern void    sys_beep(void);
+extern int     sys_bgcheck(int, BOOL);
+extern void    sys_bgend(int);
+extern int     sys_bgstart(void);
+extern int     sys_batchcount(void);
+extern int     sys_batchstart(FILE *);
+extern int     sys_batchwait(int *);
+extern BOOL    sys_cachematch(uschar **, uschar *, uschar *);
+extern BOOL    sys_cachename(uschar *, uschar *);
+extern long int sys_cachenumber(uschar **, uschar *);
+extern void    sys_cacheputnumber(FILE *, long int);
+extern void    sys_cacheputstring(FILE *, uschar *);
+extern uschar *sys_cacheread(uschar *, uschar *, uschar **, uschar **);
+extern uschar *sys_cachestring(uschar **, uschar *, long int *);
+extern void    sys_cachewriteend(FILE *, uschar *);
+extern FILE   *sys_cachewritestart(uschar *, uschar *);
 extern uschar *sys_checkfilename(uschar *);
-extern void    sys_checkinterrupt(int);
+extern void    sys_checkinterrupt(void);
+extern void    sys_citimer(BOOL);
 extern int     sys_cmdkeystroke(int *);
 extern uschar *sys_crashfilename(int);
 extern void    sys_crashposition(void);
 extern void    sys_display_cursor(int);
 extern int     sys_fcomplete(int, int *);
+extern BOOL    sys_filestamp(uschar *, FILE *, stampstr *);
 extern FILE   *sys_fopen(uschar *, uschar *);
 extern void    sys_init1(void);
 extern void    sys_init2(uschar *);
+extern BOOL    sys_isdirectory(uschar *);
+extern uschar *sys_journalname(uschar *);
 extern uschar *sys_keyreason(int);
 extern void    sys_mprintf(FILE *, const char *, ...) FPRINTF_FUNCTION;
 extern void    sys_mouse(BOOL);
@@ -647,7 +771,25 @@ extern void    sys_runscreen(void);
 extern void    sys_runwindow(void);
 extern void    sys_specialnotes(usint *, void(*)(usint, usint *));
 extern void    sys_tidy_up(void);
+extern void    trace_command(uschar *);
+extern void    trace_end(void);
+extern void    trace_input(int);
+extern void    trace_key(int, int);
+extern void    trace_open(uschar *, int, char **);
+extern int     trace_phase(int);
+extern BOOL    undo_active(void);
+extern BOOL    undo_fits(size_t);
+extern void    undo_begin(BOOL);
+extern void    undo_discard(bufferstr *);
+extern void    undo_inserted(linestr *, linestr *, int);
+extern void    undo_removed(linestr *, linestr *, int, linestr *, linestr *);
+extern void    undo_text(linestr *);
+extern BOOL    undo_undoredo(BOOL);
 extern int     utf82ord(uschar *, int *);
+extern usint   utf8_count(uschar *, usint, usint);
+extern const char *utf8_kernel(const char *);
+extern usint   utf8_offset(uschar *, usint, usint, usint);
+extern BOOL    utf8_valid(uschar *, usint);
 extern void    version_init(void);
 
 /* Function variables */
@@ -2,10 +2,10 @@
 *       The E text editor - 3rd incarnation      *
 *************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2024 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: September 2024 */
+/* This file last modified: October 2026 */
 
 
 /* This file contains initializing code, including the main program, which is
@@ -14,6 +14,11 @@ the entry point to NE. It also contains termination code. */
 #include "ehdr.h"
 #include "cmdhdr.h"
 
+/* Options for batch mode */
+
+static BOOL    batch_mode = FALSE;
+static int     batch_jobs = 0;
+static uschar *batch_listname = NULL;
 
 
 /*************************************************
@@ -28,7 +33,7 @@ static void
 sigint_handler(int sig)
 {
 (void)sig;
-main_escape_pressed = TRUE;
+main_escape_pressed = main_cicheck = TRUE;
 }
 /* LCOV_EXCL_STOP */
 
@@ -47,7 +52,7 @@ static void
 fgets_sigint_handler(int sig)
 {
 (void)sig;
-main_escape_pressed = TRUE;
+main_escape_pressed = main_cicheck = TRUE;
 longjmp(rdline_env, 1);
 }
 /* LCOV_EXCL_STOP */
@@ -58,21 +63,21 @@ longjmp(rdline_env, 1);
 *            Test for interruption               *
 *************************************************/
 
-/* The call to sys_checkinterrupt() allows for checking in addition to the
-normal signal handler. Used in Unix to check for ctrl/c explicitly in raw input
-mode. To help avoid obeying expensive system calls too often, a count of calls
-since the last command line was read is maintained, and the type of activity in
-progress at the time of the call is also passed on.
+/* This is called via the main_interrupted() macro only when main_cicheck is
+set, which happens when the interrupt handler runs, and at intervals while
+commands are being obeyed in screen mode (see sys_citimer()). The call to
+sys_checkinterrupt() allows for checking in addition to the normal signal
+handler. Used in Unix to check for ctrl/c explicitly in raw input mode.
 
-Argument:  one of the ci_xxx enumerations
-Returns:   TRUE if interrupted
+Arguments:  none
+Returns:    TRUE if interrupted
 */
 
 BOOL
-main_interrupted(int type)
+main_checkinterrupt(void)
 {
-main_cicount++;
-sys_checkinterrupt(type);
+main_cicheck = FALSE;
+sys_checkinterrupt();
 if (main_escape_pressed)
   {
   /* LCOV_EXCL_START */
@@ -155,32 +160,63 @@ buffer->filename = name;
 buffer->filealias = alias;
 buffer->readonly = main_readonly;
 
+/* When -recover is given, files named on the command line are recovered from
+their journals if they have them. */
+
+if (main_recover && !main_initialized && journal_recover(buffer))
+  {
+  if (f != NULL && f != stdin) fclose(f);
+  }
+
 /* If no file is involved, set up a single EOF line. */
 
-if (f == NULL)
+else if (f == NULL)
   {
   buffer->bottom = buffer->top = store_getlbuff(0);
   buffer->top->flags |= lf_eof;
   buffer->top->key = buffer->linecount = 1;
   }
 
-/* Otherwise, read the file into the buffer and close the file. */
+/* Otherwise, read the file into the buffer and close the file. When files
+named on the command line are being loaded for screen editing, only the first
+part of each is read here, so that the screen can be displayed at once. The
+rest is read by file_loadnext() while waiting for keystrokes, or by
+file_loadrest() when all of it is needed. An end-of-file line is added to the
+part that has been read. */
 
 else
   {
+  int count = (main_screenOK && !main_initialized && f != stdin)?
+    LOAD_CHUNK : BIGNUMBER;
+
   buffer->bottom = buffer->top = file_nextline(f, &buffer->binoffset);
   buffer->top->key = buffer->linecount = 1;
 
   while ((buffer->bottom->flags & lf_eof) == 0)
     {
     linestr *last = buffer->bottom;
-    buffer->bottom = file_nextline(f, &buffer->binoffset);
+    if (--count <= 0)
+      {
+      buffer->bottom = store_getlbuff(0);
+      buffer->bottom->flags |= lf_eof;
+      }
+    else buffer->bottom = file_nextline(f, &buffer->binoffset);
     buffer->bottom->key = buffer->imax += 1;
     last->next = buffer->bottom;
     buffer->bottom->prev = last;
     buffer->linecount += 1;
     }
-  fclose(f);
+
+  if (count > 0)
+    {
+    journal_loaded(buffer, f);
+    fclose(f);
+    }
+  else
+    {
+    buffer->loadfid = f;
+    main_loading = TRUE;
+    }
   }
 
 /* The current line is the top. */
@@ -220,7 +256,7 @@ if (currentbuffer != NULL)   /* NULL => selecting the very first buffer */
   currentbuffer->imin = main_imin;
   currentbuffer->linecount = main_linecount;
   currentbuffer->markcol = mark_col;
-  currentbuffer->markcol = mark_col_global;
+  currentbuffer->markcol_global = mark_col_global;
   currentbuffer->markline = mark_line;
   currentbuffer->markline_global = mark_line_global;
   currentbuffer->marktype = mark_type;
@@ -317,6 +353,7 @@ if (fid == NULL && fromname != NULL && fromname[0] != 0)
 firstbuffer = main_bufferchain = store_Xget(sizeof(bufferstr));
 init_buffer(main_bufferchain, 0, store_copystring(toname),
   store_copystring(toname), fid);
+cmd_hashbuffer(main_bufferchain, TRUE);
 main_nextbufferno = 1;
 init_selectbuffer(main_bufferchain);
 
@@ -324,13 +361,13 @@ main_filechanged = TRUE;
 if ((fromname == NULL && toname == NULL) ||
     (fromname != NULL && toname != NULL && Ustrcmp(fromname, toname) == 0 &&
       Ustrcmp(fromname, "-") != 0))
-        main_filechanged = FALSE;
+        main_filechanged = main_bufferchain->changed;   /* TRUE if recovered */
 
 cmd_stackptr = 0;
 last_se = NULL;
 last_gse = last_abese = NULL;
 last_gnt = last_abent = NULL;
-main_proclist = NULL;
+(void)memset(main_proclist, 0, proc_hashsize * sizeof(procstr *));
 cut_buffer = NULL;
 cmd_cbufferline = NULL;
 main_undelete = main_lastundelete = NULL;
@@ -367,19 +404,27 @@ void givehelp(void)
 printf("NE %s %s using PCRE2 %s\n%s\n\n", version_string, version_date,
   version_pcre, version_copyright);
 printf("-b[inary]        run in binary mode\n");
+printf("-batch           edit each input file separately with the -with commands\n");
+printf("-filelist <file> more input files for -batch, one per line, - means stdin\n");
 printf("-from <files>    input files, default null, - means stdin, key can be omitted\n");
+printf("-headless <file> keep the screen in memory - testing feature\n");
 printf("-[-]h[elp]       output this help\n");
 printf("-id              show current version\n");
+printf("-jobs <n>        number of files edited at once by -batch\n");
 printf("-line            run in line-by-line mode\n");
 printf("-noinit or -norc don\'t obey .nerc file\n");
 printf("-notabs          no special tab treatment\n");
 printf("-notraps         don't catch signals (debugging option)\n");
 printf("-opt <string>    initial line of commands\n");
 printf("-r[eadonly]      start in readonly state\n");
+printf("-recover         recover files from their journals after a crash\n");
+printf("-stats           write statistics to NEdebug at exit\n");
 printf("-tabin           expand input tabs; no tabs on output\n");
 printf("-tabout          use tabs in all output lines\n");
 printf("-tabs            expand input tabs; retab those lines on output\n");
-printf("-[t]o <file>     output file for 1st input, default = from\n");
+printf("-[t]o <file>     output file for 1st input, default = from;\n");
+printf("                   with -batch, the directory for all output files\n");
+printf("-trace <file>    write a timed trace of keystrokes and commands\n");
 printf("-ver <file>      verification file, default is screen\n");
 printf("-[-]v[ersion]    show current version\n");
 printf("-w[idechars]     recognize UTF-8 characters in files\n");
@@ -394,6 +439,7 @@ printf("          EXAMPLES\n");
 printf("ne myfile -notabs\n");
 printf("ne myfile -with commands -to outfile\n");
 printf("ne -line file1 file2 -notabs\n");
+printf("ne -batch *.c -with commands -jobs 4\n");
 }
 
 
@@ -425,7 +471,9 @@ key string below. */
 enum { arg_from,     arg_to=MAX_FROM, arg_id,        arg_help,   arg_line,
        arg_with,     arg_ver,         arg_opt,       arg_noinit, arg_tabs,
        arg_tabin,    arg_tabout,      arg_notabs,    arg_binary, arg_notraps,
-       arg_readonly, arg_widechars,   arg_withkeys,  arg_wks,    arg_end };
+       arg_readonly, arg_recover,     arg_widechars, arg_withkeys, arg_wks,
+       arg_batch,    arg_jobs,        arg_filelist,  arg_stats,
+       arg_trace,    arg_headless,    arg_end };
 
 /* Macro magic to get the MAX_FROM value inserted as part of the key list
 string. */
@@ -437,7 +485,8 @@ uschar *argstring = US
   XSTR(MAX_FROM)
   ",to=o/k,id=-version=version=v/s,help=-help=h/s,line/s,with/k,ver/k,"
   "opt/k,noinit=norc/s,tabs/s,tabin/s,tabout/s,notabs/s,binary=b/s,"
-  "notraps/s,readonly=r/s,widechars=w/s,withkeys/k,wks/k/n";
+  "notraps/s,readonly=r/s,recover/s,widechars=w/s,withkeys/k,wks/k/n,"
+  "batch/s,jobs/k/n,filelist/k,stats/s,trace/k,headless/k";
 #undef STR
 #undef XSTR
 
@@ -508,6 +557,10 @@ if (results[arg_binary].data.number != 0)
 
 if (results[arg_readonly].data.number != 0) main_readonly = TRUE;
 
+/* Recover option */
+
+if (results[arg_recover].data.number != 0) main_recover = TRUE;
+
 /* Widechars option */
 
 if (results[arg_widechars].data.number != 0) allow_wide = TRUE;
@@ -516,6 +569,10 @@ if (results[arg_widechars].data.number != 0) allow_wide = TRUE;
 
 if (results[arg_notraps].data.number != 0) no_signal_traps = TRUE;
 
+/* Stats option */
+
+if (results[arg_stats].data.number != 0) main_dumpstats = TRUE;
+
 /* Deal with an initial opt command line */
 
 main_opt = results[arg_opt].data.text;
@@ -586,12 +643,42 @@ if (results[arg_to].data.text != NULL)
     }
   }
 
+/* Batch mode needs a command file, and it cannot be used with a verification
+file or a trace, because the output for each file is shown separately. The
+input files cannot include the standard input. If -to is given, it must be an
+existing directory. */
+
+if (results[arg_batch].data.number != 0)
+  {
+  batch_mode = TRUE;
+  main_screenmode = main_screenOK = main_interactive = FALSE;
+  if (arg_with_name == NULL) error_moan(82);                  /* Hard */
+  if (arg_ver_name != NULL) error_moan(84, "-ver");           /* Hard */
+  if (results[arg_trace].data.text != NULL)
+    error_moan(84, "-trace");                                 /* Hard */
+  if (arg_from_name != NULL && Ustrcmp(arg_from_name, "-") == 0)
+    error_moan(84, "\"-\" as an input file");                /* Hard */
+  if (arg_to_name != NULL && !sys_isdirectory(arg_to_name))
+    error_moan(86, arg_to_name);                              /* Hard */
+  batch_jobs = (results[arg_jobs].presence != arg_present_not)?
+    results[arg_jobs].data.number : sys_batchcount();
+  if (batch_jobs < 1) batch_jobs = 1;
+  batch_listname = results[arg_filelist].data.text;
+  if (batch_listname != NULL && Ustrcmp(batch_listname, "-") == 0 &&
+      Ustrcmp(arg_with_name, "-") == 0)
+    error_moan(60, "-filelist or -with", "input");            /* Hard */
+  }
+else if (results[arg_jobs].presence != arg_present_not)
+  error_moan(83, "-jobs");                                    /* Hard */
+else if (results[arg_filelist].data.text != NULL)
+  error_moan(83, "-filelist");                                /* Hard */
+
 /* Set up a file that contains data for creating simulated keystrokes for
 automatic testing of screen mode. */
 
 if (results[arg_withkeys].data.text != NULL)
   {
-  if (!main_screenmode) error_moan(72);  /* Hard */
+  if (!main_screenmode) error_moan(72, "-withkeys");  /* Hard */
   withkey_fid = sys_fopen(results[arg_withkeys].data.text, US"r");
   if (withkey_fid == NULL)
     {
@@ -604,6 +691,20 @@ if (results[arg_withkeys].data.text != NULL)
   if (results[arg_wks].presence != arg_present_not)
     withkey_sleep = results[arg_wks].data.number;    /* LCOV_EXCL_LINE */
   }
+
+/* Set up a screen in memory instead of on the terminal, for testing and
+measuring the screen handling. */
+
+if (results[arg_headless].data.text != NULL)
+  {
+  if (!main_screenmode) error_moan(72, "-headless");  /* Hard */
+  arg_headless_name = store_copystring(results[arg_headless].data.text);
+  }
+
+/* Set up a trace of keystrokes and commands, with timings. */
+
+if (results[arg_trace].data.text != NULL)
+  trace_open(results[arg_trace].data.text, argc, argv);
 }
 
 
@@ -686,13 +787,323 @@ key_codes['_']   = 31;
 
 
 
+/*************************************************
+*       Cache of an initialization file          *
+*************************************************/
+
+/* When the only commands obeyed from an initialization file are ones whose
+effects are confined to the settings listed below, the word characters, the
+key table, the function keystrings, the command history, and the procedures
+(see cmd_cacheable in ecmdcomp.c), those effects are saved in a cache file. The
+next time NE starts with the same file, the cache is loaded instead of
+compiling the file's commands again.
+
+Some commands depend on the state before they are obeyed (for example, an
+ON/OFF command without an argument is a toggle), so the state before the file
+is obeyed is saved as well, and must match. The name of the cache file is
+derived from a hash of the file's contents and of that state, so that each
+terminal type, whose key tables may differ, gets its own cache. */
+
+#define IC_CACHE_MAGIC "NE init cache 1"
+
+static int *ic_settings[] = {
+  &allow_wide, &cmd_casematch, &main_appendswitch, &main_AutoAlign,
+  &main_backupfiles, &main_eightbit, &main_ilinevalue, &main_oldcomment,
+  &main_overstrike, &main_readonly, (int *)&main_rmargin, &main_screenmode,
+  &main_vcursorscroll, &main_vmousescroll, &main_warnings, &screen_subchar };
+
+#define ic_settings_count (int)(sizeof(ic_settings)/sizeof(int *))
+
+
+/* The FNV-1a hash is used. */
+
+static uint64_t
+ic_hash(uint64_t h, const void *data, size_t len)
+{
+const uschar *p = data;
+while (len-- > 0) h = (h ^ *p++) * UINT64_C(1099511628211);
+return h;
+}
+
+static uint64_t
+ic_statehash(uint64_t h)
+{
+for (int i = 0; i < ic_settings_count; i++)
+  h = ic_hash(h, ic_settings[i], sizeof(int));
+h = ic_hash(h, &main_undolimit, sizeof(main_undolimit));
+h = ic_hash(h, ch_tab, 256);
+h = ic_hash(h, key_table, key_tablesize * sizeof(short int));
+for (int i = 0; i <= max_keystring; i++)
+  {
+  uschar *s = main_keystrings[i];
+  h = (s == NULL)? ic_hash(h, "", 1) : ic_hash(h, s, Ustrlen(s) + 1);
+  }
+return h;
+}
+
+
+/* The state that can be changed by the file is copied before the file is
+obeyed, so that it can be written to the cache afterwards; the cache file is
+not opened until then, because an error in the file ends the run. */
+
+typedef struct {
+  int        settings[ic_settings_count];
+  size_t     undolimit;
+  uschar     chars[256];
+  short int *keys;
+  uschar    *strings[max_keystring + 1];
+} icstatestr;
+
+static void
+ic_getstate(icstatestr *st)
+{
+for (int i = 0; i < ic_settings_count; i++)
+  st->settings[i] = *(ic_settings[i]);
+st->undolimit = main_undolimit;
+memcpy(st->chars, ch_tab, 256);
+st->keys = store_Xget(key_tablesize * sizeof(short int));
+memcpy(st->keys, key_table, key_tablesize * sizeof(short int));
+for (int i = 0; i <= max_keystring; i++)
+  st->strings[i] = store_copystring(main_keystrings[i]);
+}
+
+static void
+ic_freestate(icstatestr *st)
+{
+store_free(st->keys);
+for (int i = 0; i <= max_keystring; i++) store_free(st->strings[i]);
+}
+
+static void
+ic_putstate(FILE *f, icstatestr *st)
+{
+for (int i = 0; i < ic_settings_count; i++)
+  sys_cacheputnumber(f, st->settings[i]);
+sys_cacheputnumber(f, (long int)st->undolimit);
+sys_cacheputnumber(f, 256);
+fwrite(st->chars, 1, 256, f);
+sys_cacheputnumber(f, key_tablesize * sizeof(short int));
+fwrite(st->keys, sizeof(short int), key_tablesize, f);
+for (int i = 0; i <= max_keystring; i++)
+  sys_cacheputstring(f, st->strings[i]);
+}
+
+
+/* Check that the current state is the same as a saved one.
+
+Arguments:
+  aptr      points to the pointer to the data, which is updated
+  end       the end of the data
+
+Returns:    TRUE if the state is the same
+*/
+
+static BOOL
+ic_checkstate(uschar **aptr, uschar *end)
+{
+uschar *s;
+long int len;
+
+for (int i = 0; i < ic_settings_count; i++)
+  if (sys_cachenumber(aptr, end) != *(ic_settings[i])) return FALSE;
+if (sys_cachenumber(aptr, end) != (long int)main_undolimit) return FALSE;
+
+s = sys_cachestring(aptr, end, &len);
+if (s == NULL || len != 256 || memcmp(s, ch_tab, 256) != 0) return FALSE;
+s = sys_cachestring(aptr, end, &len);
+if (s == NULL || len != (long int)(key_tablesize * sizeof(short int)) ||
+    memcmp(s, key_table, len) != 0) return FALSE;
+
+for (int i = 0; i <= max_keystring; i++)
+  {
+  uschar *k = main_keystrings[i];
+  s = sys_cachestring(aptr, end, &len);
+  if (*aptr == NULL) return FALSE;
+  if (s == NULL || k == NULL)
+    {
+    if (s != k) return FALSE;
+    }
+  else if (len != (long int)Ustrlen(k) || Ustrncmp(s, k, len) != 0)
+    return FALSE;
+  }
+
+return *aptr != NULL;
+}
+
+
+/* Save the effects of obeying an initialization file. This is called only if
+all the commands that were obeyed were cacheable.
+
+Arguments:
+  name      the name of the cache file
+  size      the size of the initialization file
+  hash      the hash of its contents and of the state before it was obeyed
+  before    the state before it was obeyed
+
+Returns:    nothing
+*/
+
+static void
+ic_cachesave(uschar *name, long int size, uint64_t hash, icstatestr *before)
+{
+icstatestr after;
+long int count = 0;
+FILE *f = sys_cachewritestart(name, US IC_CACHE_MAGIC);
+
+if (f == NULL) return;
+sys_cacheputnumber(f, size);
+sys_cacheputnumber(f, (long int)hash);
+ic_putstate(f, before);
+ic_getstate(&after);
+ic_putstate(f, &after);
+ic_freestate(&after);
+
+sys_cacheputnumber(f, cmd_stackptr);
+for (int i = 0; i < cmd_stackptr; i++) sys_cacheputstring(f, cmd_stack[i]);
+
+for (int i = 0; i < proc_hashsize; i++)
+  for (procstr *p = main_proclist[i]; p != NULL; p = p->next) count++;
+sys_cacheputnumber(f, count);
+for (int i = 0; i < proc_hashsize; i++)
+  for (procstr *p = main_proclist[i]; p != NULL; p = p->next)
+    cmd_saveblock(f, (cmdblock *)p);
+
+sys_cachewriteend(f, name);
+}
+
+
+/* Load the cache, if it is present and valid. Everything is read and checked
+before any of it is used, so that if the cache is not valid, the file can be
+obeyed as normal.
+
+Arguments:
+  name      the name of the cache file
+  size      the size of the initialization file
+  hash      the hash of its contents and of the state
+
+Returns:    TRUE if the cache has been loaded
+*/
+
+static BOOL
+ic_cacheload(uschar *name, long int size, uint64_t hash)
+{
+long int values[ic_settings_count];
+long int undolimit, stackcount, proccount, len;
+uschar *buffer, *p, *end, *chars, *keys;
+uschar *strings[max_keystring + 1];
+long int lengths[max_keystring + 1];
+uschar *stack;
+BOOL eightbit = main_eightbit;
+BOOL wide = allow_wide;
+procstr *procs = NULL;
+BOOL yield = FALSE;
+
+buffer = sys_cacheread(name, US IC_CACHE_MAGIC, &p, &end);
+if (buffer == NULL) return FALSE;
+
+if (sys_cachenumber(&p, end) != size ||
+    sys_cachenumber(&p, end) != (long int)hash ||
+    !ic_checkstate(&p, end)) goto END;
+
+/* Pick up the state after obeying the file. */
+
+for (int i = 0; i < ic_settings_count; i++)
+  values[i] = sys_cachenumber(&p, end);
+undolimit = sys_cachenumber(&p, end);
+chars = sys_cachestring(&p, end, &len);
+if (chars == NULL || len != 256) goto END;
+keys = sys_cachestring(&p, end, &len);
+if (keys == NULL || len != (long int)(key_tablesize * sizeof(short int)))
+  goto END;
+for (int i = 0; i <= max_keystring; i++)
+  strings[i] = sys_cachestring(&p, end, lengths + i);
+
+/* The command history is checked but left in the buffer until later. */
+
+stackcount = sys_cachenumber(&p, end);
+if (p == NULL || stackcount < 0 || stackcount > cmd_stacktop) goto END;
+stack = p;
+for (int i = 0; i < stackcount; i++)
+  if (sys_cachestring(&p, end, NULL) == NULL) goto END;
+
+/* Load the procedures into a temporary chain. */
+
+proccount = sys_cachenumber(&p, end);
+if (p == NULL) goto END;
+for (int i = 0; i < proccount; i++)
+  {
+  procstr *pr = (procstr *)cmd_loadblock(&p, end);
+  if (pr == NULL || pr->type != cb_prtype)
+    {
+    cmd_freeblock((cmdblock *)pr);
+    goto END;
+    }
+  pr->next = procs;
+  procs = pr;
+  }
+if (p != end) goto END;
+
+/* All is well; install the new state. */
+
+for (int i = 0; i < ic_settings_count; i++) *(ic_settings[i]) = values[i];
+if (main_eightbit != eightbit || allow_wide != wide) screen_forcecls = TRUE;
+
+main_undolimit = (size_t)undolimit;
+if (main_undolimit == 0)
+  {
+  for (bufferstr *b = main_bufferchain; b != NULL; b = b->next)
+    undo_discard(b);
+  }
+
+memcpy(ch_tab, chars, 256);
+memcpy(key_table, keys, key_tablesize * sizeof(short int));
+
+for (int i = 0; i <= max_keystring; i++)
+  {
+  uschar *s = strings[i];
+  if (main_keystrings[i] != NULL) store_free(main_keystrings[i]);
+  main_keystrings[i] = (s == NULL)? NULL :
+    store_copystring2(s, s + lengths[i]);
+  }
+
+for (int i = 0; i < stackcount; i++)
+  {
+  uschar *s = sys_cachestring(&stack, end, &len);
+  cmd_stack[cmd_stackptr++] = store_copystring2(s, s + len);
+  }
+
+while (procs != NULL)
+  {
+  procstr *next = procs->next;
+  cmd_addproc(procs);
+  procs = next;
+  }
+
+yield = TRUE;
+
+END:
+while (procs != NULL)
+  {
+  procstr *next = procs->next;
+  cmd_freeblock((cmdblock *)procs);
+  procs = next;
+  }
+store_free(buffer);
+return yield;
+}
+
+
+
 /*************************************************
 *            Obey initialization file            *
 *************************************************/
 
 /* Function to obey an initialization file. The existence of the file has been
 tested by system-specific code. Any errors that arise will be treated as
-disasters.
+disasters. Unless caching is disabled, the file's contents are hashed, and if
+there is a valid cache, it is loaded instead of obeying the file. The command
+history must be empty, because the cache contains the history that results from
+obeying the file.
 
 Argument:    the file name
 Returns:     nothing (errors cause bomb out)
@@ -701,10 +1112,49 @@ Returns:     nothing (errors cause bomb out)
 void
 obey_init(uschar *filename)
 {
+uschar cachename[FNAME_BUFFER_SIZE];
+uschar hexname[24];
+uint64_t hash = 0;
+long int size = 0;
+BOOL caching;
+icstatestr before;
 FILE *f = sys_fopen(filename, US"r");
+
 if (f == NULL) error_moan(5, filename, "reading", strerror(errno));
+
+caching = cmd_stackptr == 0 && fseek(f, 0, SEEK_END) == 0 &&
+  (size = ftell(f)) >= 0 && fseek(f, 0, SEEK_SET) == 0;
+
+if (caching)
+  {
+  uschar *data = store_Xget(size + 1);
+  caching = fread(data, 1, size, f) == (size_t)size;
+  hash = ic_statehash(ic_hash(UINT64_C(14695981039346656037), data, size));
+  store_free(data);
+  rewind(f);
+  sprintf(CS hexname, "init-%016llx", (unsigned long long int)hash);
+  caching = caching && sys_cachename(cachename, hexname);
+  }
+
+if (caching)
+  {
+  if (ic_cacheload(cachename, size, hash))
+    {
+    fclose(f);
+    return;
+    }
+  ic_getstate(&before);
+  }
+
+init_cacheable = TRUE;
 while (Ufgets(cmd_buffer, CMD_BUFFER_SIZE, f) != NULL) cmd_obey(cmd_buffer);
 fclose(f);
+
+if (caching)
+  {
+  if (init_cacheable) ic_cachesave(cachename, size, hash, &before);
+  ic_freestate(&before);
+  }
 }
 
 
@@ -747,11 +1197,11 @@ if (init_init(NULL, fromname, toname))
 
   while (!main_done)
     {
-    main_cicount = 0;
     (void)main_interrupted(ci_read);
     if (main_verify) line_verify(main_current, TRUE, TRUE);
     signal(SIGINT, fgets_sigint_handler);
     if (main_interactive) main_rc = error_count = 0;
+    journal_flush();
     if (setjmp(rdline_env) == 0)
       {
       int n;
@@ -764,7 +1214,9 @@ if (init_init(NULL, fromname, toname))
       main_flush_interrupt();           /* resets handler */
       n = Ustrlen(cmd_buffer);
       if (n > 0 && cmd_buffer[n-1] == '\n') cmd_buffer[n-1] = 0;
+      if (trace_fid != NULL) trace_command(cmd_buffer);
       (void)cmd_obey(cmd_buffer);
+      if (trace_fid != NULL) trace_end();
       }
     else
       {
@@ -781,6 +1233,289 @@ if (init_init(NULL, fromname, toname))
 
 
 
+/*************************************************
+*            Run in batch mode                   *
+*************************************************/
+
+/* In batch mode, the -with commands (preceded by any -opt commands) are
+applied to each input file separately, exactly as in a line-by-line run with
+just that file. Each file is edited in its own process, with up to batch_jobs
+processes at once, so the work is spread over the processors, memory use is
+limited, and nothing is carried over from one file to the next. The command
+file is read once, before any processes are started.
+
+The input files are those named on the command line, followed by those listed
+in the -filelist file, which is read only as they are needed. Each output file
+is the input file, unless -to names a directory to hold them.
+
+Everything that a process outputs is held in a temporary file and copied when
+it has finished, followed by a line giving the return code and the file name.
+The final return code is the worst of them.
+
+In a worker process, this function returns when the file has been edited, so
+that the process finishes in the normal way.
+
+Arguments:  none
+Returns:    nothing
+*/
+
+typedef struct {
+  int     pid;                 /* process id, or 0 if the slot is free */
+  FILE   *out;                 /* what it has output */
+  uschar *name;                /* file it is editing */
+} batchstr;
+
+static FILE *batch_listfid = NULL;
+static int batch_next = 0;
+static BOOL batch_worker = FALSE;
+
+/* The names of the output files that have been started are kept in a hash
+table, so that two input files that would be written to the same output file,
+for example a/x and b/x with -to, are not edited at the same time, one
+silently overwriting the other. */
+
+#define BATCH_HASH 256
+
+typedef struct outnamestr {
+  struct outnamestr *next;
+  uschar name[1];              /* the name, extended as necessary */
+} outnamestr;
+
+static outnamestr *batch_outnames[BATCH_HASH];
+
+/* Record an output file name.
+
+Argument:  the name
+Returns:   TRUE if the name is new, FALSE if it has already been used
+*/
+
+static BOOL
+batch_newoutname(uschar *name)
+{
+usint h = 0;
+outnamestr **chain;
+outnamestr *p;
+
+for (uschar *s = name; *s != 0; s++) h = h*31 + *s;
+chain = batch_outnames + h % BATCH_HASH;
+for (p = *chain; p != NULL; p = p->next)
+  if (Ustrcmp(p->name, name) == 0) return FALSE;
+p = store_Xget(sizeof(outnamestr) + Ustrlen(name));
+Ustrcpy(p->name, name);
+p->next = *chain;
+*chain = p;
+return TRUE;
+}
+
+/* Get the name of the output file for an input file. This is the input file,
+unless -to names a directory, in which case the file of the same final name in
+that directory is used. */
+
+static uschar *
+batch_outname(uschar *name)
+{
+uschar *dir = arg_to_name;
+uschar *base, *yield;
+
+if (dir == NULL) return store_copystring(name);
+base = Ustrrchr(name, '/');
+base = (base == NULL)? name : base + 1;
+yield = store_Xget(Ustrlen(dir) + Ustrlen(base) + 2);
+sprintf(CS yield, "%s/%s", dir, base);
+return yield;
+}
+
+/* Get the name of the next file, or NULL when there are no more. */
+
+static uschar *
+batch_nextname(void)
+{
+uschar buffer[FNAME_BUFFER_SIZE];
+
+/* First the names on the command line */
+
+if (batch_next == 0)
+  {
+  batch_next++;
+  if (arg_from_name != NULL) return store_copystring(arg_from_name);
+  }
+if (batch_next < MAX_FROM && main_fromlist[batch_next - 1] != NULL)
+  return store_copystring(main_fromlist[batch_next++ - 1]);
+
+/* Then those in the list file */
+
+if (batch_listfid == NULL) return NULL;
+while (Ufgets(buffer, FNAME_BUFFER_SIZE, batch_listfid) != NULL)
+  {
+  int n = Ustrlen(buffer);
+  while (n > 0 && isspace(buffer[n-1])) n--;
+  buffer[n] = 0;
+  if (n > 0) return store_copystring(buffer);
+  }
+return NULL;
+}
+
+static void
+main_runbatch(void)
+{
+batchstr *workers = store_Xget(batch_jobs * sizeof(batchstr));
+FILE *f;
+uschar *script;
+size_t scriptsize = 0;
+size_t scriptmax = 1024;
+int running = 0;
+int count = 0;
+int failed = 0;
+int worst = 0;
+
+/* Read the command file into memory */
+
+f = (Ustrcmp(arg_with_name, "-") == 0)? stdin : sys_fopen(arg_with_name, US"r");
+if (f == NULL) error_moan(5, arg_with_name, "reading", strerror(errno));
+script = store_Xget(scriptmax);
+for (;;)
+  {
+  size_t n = fread(script + scriptsize, 1, scriptmax - scriptsize, f);
+  scriptsize += n;
+  if (n == 0) break;
+  if (scriptsize == scriptmax)
+    {
+    uschar *new = store_Xget(scriptmax * 2);
+    memcpy(new, script, scriptsize);
+    store_free(script);
+    script = new;
+    scriptmax *= 2;
+    }
+  }
+if (f != stdin) fclose(f);
+
+if (batch_listname != NULL)
+  {
+  batch_listfid = (Ustrcmp(batch_listname, "-") == 0)? stdin :
+    sys_fopen(batch_listname, US"r");
+  if (batch_listfid == NULL)
+    error_moan(5, batch_listname, "reading", strerror(errno));
+  }
+
+for (int i = 0; i < batch_jobs; i++) workers[i].pid = 0;
+
+/* Keep up to batch_jobs processes running until all the files have been
+started, or there is an interrupt. */
+
+for (;;)
+  {
+  int pid, rc;
+  batchstr *w;
+
+  while (running < batch_jobs && !main_escape_pressed)
+    {
+    uschar *name = batch_nextname();
+    uschar *outname;
+    if (name == NULL) break;
+
+    /* A file whose output would go to the same place as an earlier one's is
+    not edited. */
+
+    outname = batch_outname(name);
+    if (!batch_newoutname(outname))
+      {
+      error_printf("** %s is not edited: its output file %s is also the "
+        "output for an earlier input file\n", name, outname);
+      error_printf("rc=8 %s\n", name);
+      store_free(outname);
+      store_free(name);
+      count++;
+      failed++;
+      if (worst < 8) worst = 8;
+      continue;
+      }
+
+    for (w = workers; w->pid != 0; w++);
+    w->name = name;
+    w->out = tmpfile();
+    pid = (w->out == NULL)? -1 : sys_batchstart(w->out);
+
+    /* In the worker process, edit the file as in a line-by-line run. */
+
+    if (pid == 0)
+      {
+      arg_from_name = name;
+      if (arg_to_name != NULL) arg_to_name = outname;
+      batch_worker = TRUE;
+      main_fromlist[0] = NULL;
+      cmdin_fid = (scriptsize == 0)? NULL : fmemopen(script, scriptsize, "r");
+      arg_with_name = NULL;
+      if (batch_listfid != NULL && batch_listfid != stdin)
+        fclose(batch_listfid);
+      main_runlinebyline();
+      return;
+      }
+
+    count++;
+    if (pid < 0)
+      {
+      /* LCOV_EXCL_START */
+      error_printf("** Failed to start a process to edit %s: %s\n", name,
+        strerror(errno));
+      error_printf("rc=16 %s\n", name);
+      if (w->out != NULL) fclose(w->out);
+      store_free(name);
+      failed++;
+      worst = 16;
+      continue;
+      /* LCOV_EXCL_STOP */
+      }
+
+    w->pid = pid;
+    running++;
+    }
+
+  if (running == 0) break;
+
+  /* Wait for a process to finish, and show what it output. */
+
+  pid = sys_batchwait(&rc);
+  if (pid < 0) break;     /* LCOV_EXCL_LINE - should not happen */
+  for (w = workers; w < workers + batch_jobs; w++) if (w->pid == pid) break;
+  if (w >= workers + batch_jobs) continue;   /* LCOV_EXCL_LINE */
+
+  rewind(w->out);
+  for (;;)
+    {
+    uschar buffer[1024];
+    size_t n = fread(buffer, 1, sizeof(buffer), w->out);
+    if (n == 0) break;
+    fwrite(buffer, 1, n, msgs_fid);
+    }
+  fclose(w->out);
+
+  error_printf("rc=%d %s\n", rc, w->name);
+  if (rc >= 8) failed++;                   /* serious or worse */
+  if (rc > worst) worst = rc;
+  store_free(w->name);
+  w->pid = 0;
+  running--;
+  }
+
+if (batch_listfid != NULL && batch_listfid != stdin) fclose(batch_listfid);
+store_free(workers);
+store_free(script);
+
+if (main_escape_pressed)
+  {
+  /* LCOV_EXCL_START */
+  error_printf("** Batch run interrupted\n");
+  if (worst < 8) worst = 8;
+  /* LCOV_EXCL_STOP */
+  }
+
+error_printf("%d file%s edited, %d with errors\n", count,
+  (count == 1)? "" : "s", failed);
+main_rc = worst;
+}
+
+
+
 /*************************************************
 *          Set up default tab options            *
 *************************************************/
@@ -805,13 +1540,22 @@ else error_moan(71, main_tabs);   /* Hard error because still initializing */
 *           Exit tidy-up function                *
 *************************************************/
 
-/* Automatically called for any exit. Free the extensible buffers and other
-memory. */
+/* Automatically called for any exit. If -stats was given, write the
+statistics to the debug file, except in a batch worker, where they are output
+with the rest of what it says about its file, because the workers would
+otherwise overwrite each other's debug files. Free the extensible buffers and
+other memory. */
 
 static void
 tidy_up(void)
 {
+if (main_dumpstats) debug_stats(!batch_worker);
 if (debug_file != NULL) fclose(debug_file);
+if (trace_fid != NULL)
+  {
+  trace_end();
+  fclose(trace_fid);
+  }
 if (crash_logfile != NULL) fclose(crash_logfile);
 
 /* The PCRE2 free() functions do nothing if the argument is NULL (not
@@ -843,6 +1587,7 @@ cmd_buffer = cbuffer;                /* Make globally available */
 kbd_fid = cmdin_fid = stdin;         /* Default */
 msgs_fid = stdout;                   /* Default */
 setvbuf(msgs_fid, NULL, _IONBF, 0);  /* Set unbuffered */
+main_stats.start = time(NULL);       /* For SHOW STATS */
 
 if (atexit(tidy_up) != 0) error_moan(68);  /* Hard */
 
@@ -864,6 +1609,10 @@ if ((arg_from_name != NULL && Ustrcmp(arg_from_name, "-") == 0) ||
     (arg_to_name != NULL && Ustrcmp(arg_to_name, "-") == 0))
       main_interactive = main_screenmode = main_screenOK = FALSE;
 
+/* Crash-recovery journals are kept only when editing interactively. */
+
+main_journal = main_interactive && !main_binary;
+
 /* Note if messages are to a terminal */
 
 msgs_tty = isatty(fileno(msgs_fid));
@@ -891,10 +1640,13 @@ if (main_screenmode)
   cmdin_fid = NULL;
   sys_runscreen();
   }
+else if (batch_mode) main_runbatch();
 else main_runlinebyline();
 
-/* A final newline is needed in some circumstances. */
+/* Normal ending: the journals are no longer needed. A final newline is needed
+in some circumstances. */
 
+journal_endall();
 if (main_screenOK && main_nlexit && main_pendnl) sys_mprintf(msgs_fid, "\r\n");
 return sys_rc(main_rc);
 }
@@ -0,0 +1,1164 @@
+/*************************************************
+*       The E text editor - 3rd incarnation      *
+*************************************************/
+
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
+
+/* Written by Philip Hazel, starting November 1991 */
+/* This file last modified: October 2026 */
+
+
+/* This file contains code for maintaining the crash-recovery journals and for
+recovering buffers from them.
+
+While editing interactively, each buffer that has a file name has a journal
+file, named by sys_journalname(), to which a record of each change is
+appended. If NE is killed, or the system goes down, the -recover option
+rebuilds the buffer from the journal. Journals are deleted when NE finishes
+normally. A journal starts with a header line and a base, which is one of:
+
+  F<size> <mtime> <inode>   The buffer's own file, as identified
+  S<count>                  A copy of all the lines (a checkpoint)
+
+The records that follow identify lines by their index in the buffer, starting
+at zero and counting the end-of-file line:
+
+  I<index> <count>   Lines inserted, followed by their texts
+  D<index> <count>   Lines deleted
+  T<index> <text>    The new text of a line
+  E                  End of a batch
+
+Each text is written as its length, a colon, the bytes, and a newline.
+Records are collected in memory, and written out as a batch when NE is idle,
+that is, when no keystroke has arrived for half a second, or when it is
+waiting for a command line. Only complete batches are replayed, so a batch
+that was being written when the system failed is ignored.
+
+Insertions and deletions are recorded as they happen, because the indexes of
+the lines are needed then. Finding an index means walking along the chain, so
+the index of one line is remembered, and a walk from there is used when that
+is shorter. For a line whose text is changed, only the line is noted; its
+index and final text are found when the batch is written. A line that is
+deleted is removed from the list of noted lines.
+
+A journal's base is the file after a buffer has been loaded or saved, and a
+copy of the buffer otherwise. So that replaying is never much slower than
+loading, a new journal with a copy of the buffer is written when the records
+become larger than the base. */
+
+#include "ehdr.h"
+
+#define JOURNAL_MINCHECK  (1024*1024)  /* Minimum records before checkpoint */
+#define JOURNAL_MINDIRTY  64           /* Initial size of dirty vector */
+
+static uschar *header = US"NEjournal 1\n";
+
+
+
+/*************************************************
+*          Cached buffer values                  *
+*************************************************/
+
+/* Some buffer values are held in global variables while the buffer is
+current. */
+
+static linestr *
+buffertop(bufferstr *b)
+{
+return (b == currentbuffer)? main_top : b->top;
+}
+
+static uschar *
+buffername(bufferstr *b)
+{
+return (b == currentbuffer)? main_filename : b->filename;
+}
+
+static BOOL
+bufferchanged(bufferstr *b)
+{
+return (b == currentbuffer)? main_filechanged : b->changed;
+}
+
+
+
+/*************************************************
+*        Add to the batch of records             *
+*************************************************/
+
+static void
+addbytes(journalstr *j, const void *s, size_t n)
+{
+if (j->batchlen + n > j->batchmax)
+  {
+  size_t newmax = 2*j->batchmax + n;
+  uschar *newbatch = store_Xget(newmax);
+  if (j->batchlen > 0) memcpy(newbatch, j->batch, j->batchlen);
+  store_free(j->batch);
+  j->batch = newbatch;
+  j->batchmax = newmax;
+  }
+memcpy(j->batch + j->batchlen, s, n);
+j->batchlen += n;
+}
+
+static void
+addrecord(journalstr *j, int type, int index, int count)
+{
+uschar buff[40];
+addbytes(j, buff, (type == 'T')?
+  sprintf(CS buff, "T%d ", index) : sprintf(CS buff, "%c%d %d\n", type,
+    index, count));
+}
+
+static void
+addtext(journalstr *j, linestr *line)
+{
+uschar buff[20];
+addbytes(j, buff, sprintf(CS buff, "%u:", line->len));
+if (line->len > 0) addbytes(j, line->text, line->len);
+addbytes(j, "\n", 1);
+}
+
+
+
+/*************************************************
+*          Maintain the list of dirty lines      *
+*************************************************/
+
+/* The vector of dirty lines is in the order in which they were first changed,
+which is usually the best order for finding their indexes. The hash table
+contains 1 + the vector offset of each line, zero for an unused entry, or -1
+for an entry whose line has been removed. Its size is twice the vector size. */
+
+static int
+hashstart(journalstr *j, linestr *line)
+{
+return (int)((((uintptr_t)line >> 4) * 2654435761u) &
+  (usint)(2*j->dirtymax - 1));
+}
+
+static void
+dirtyreset(journalstr *j, int size)
+{
+if (size != j->dirtymax)
+  {
+  store_free(j->dirty);
+  store_free(j->hash);
+  j->dirty = store_Xget(size * sizeof(linestr *));
+  j->hash = store_Xget(2 * size * sizeof(int));
+  j->dirtymax = size;
+  }
+memset(j->hash, 0, 2 * size * sizeof(int));
+j->dirtycount = j->dirtylive = 0;
+}
+
+static void
+dirtyadd(journalstr *j, linestr *line)
+{
+int mask = 2*j->dirtymax - 1;
+int h;
+
+for (h = hashstart(j, line); j->hash[h] != 0; h = (h + 1) & mask)
+  if (j->hash[h] > 0 && j->dirty[j->hash[h] - 1] == line) return;
+
+/* When the vector is full, remove deleted entries, enlarging it if more than
+half of them are in use. */
+
+if (j->dirtycount >= j->dirtymax)
+  {
+  linestr **old = j->dirty;
+  int count = j->dirtycount;
+  int live = j->dirtylive;
+
+  j->dirty = NULL;
+  j->dirtymax = 0;
+  dirtyreset(j, (live > count/2)? 2*count : count);
+  for (int i = 0; i < count; i++)
+    if (old[i] != NULL) dirtyadd(j, old[i]);
+  store_free(old);
+  dirtyadd(j, line);
+  return;
+  }
+
+j->dirty[j->dirtycount++] = line;
+j->dirtylive++;
+j->hash[h] = j->dirtycount;
+}
+
+static void
+dirtyremove(journalstr *j, linestr *line)
+{
+int mask = 2*j->dirtymax - 1;
+for (int h = hashstart(j, line); j->hash[h] != 0; h = (h + 1) & mask)
+  {
+  if (j->hash[h] > 0 && j->dirty[j->hash[h] - 1] == line)
+    {
+    j->dirty[j->hash[h] - 1] = NULL;
+    j->hash[h] = -1;
+    j->dirtylive--;
+    return;
+    }
+  }
+}
+
+
+
+/*************************************************
+*            Find a line's index                 *
+*************************************************/
+
+/* One walk goes back from the line, to the top or the cached line; another
+goes forward from the cached line. Whichever finds the answer first wins, so
+the cost is proportional to the shorter distance.
+
+Arguments:
+  j          the journal
+  b          the buffer
+  line       the line
+
+Returns:     the index, or -1 if the line is not in the buffer
+*/
+
+static int
+lineindex(journalstr *j, bufferstr *b, linestr *line)
+{
+linestr *top = buffertop(b);
+linestr *back = line;
+linestr *fwd = j->cacheline;
+int nback = 0;
+int nfwd = 0;
+
+for (;;)
+  {
+  if (back == j->cacheline) return j->cacheindex + nback;
+  if (back->prev == NULL) return (back == top)? nback : -1;
+  back = back->prev;
+  nback++;
+
+  if (fwd != NULL)
+    {
+    if (fwd == line) return j->cacheindex + nfwd;
+    fwd = fwd->next;
+    nfwd++;
+    }
+  }
+}
+
+
+
+/*************************************************
+*       Create and destroy journal blocks        *
+*************************************************/
+
+static journalstr *
+newjournal(bufferstr *b)
+{
+journalstr *j = store_Xget(sizeof(journalstr));
+(void)memset(j, 0, sizeof(journalstr));
+j->name = sys_journalname(buffername(b));
+j->filename = store_copystring(buffername(b));
+j->cacheline = buffertop(b);
+dirtyreset(j, JOURNAL_MINDIRTY);
+b->journal = j;
+return j;
+}
+
+static void
+freejournal(bufferstr *b)
+{
+journalstr *j = b->journal;
+store_free(j->name);
+store_free(j->filename);
+store_free(j->batch);
+store_free(j->dirty);
+store_free(j->hash);
+store_free(j);
+b->journal = NULL;
+}
+
+
+
+/*************************************************
+*              End a journal                     *
+*************************************************/
+
+/* The file is closed and deleted, and the block is freed.
+
+Argument:  the buffer
+Returns:   nothing
+*/
+
+void
+journal_end(bufferstr *b)
+{
+journalstr *j = b->journal;
+if (j == NULL) return;
+if (j->fid != NULL)
+  {
+  fclose(j->fid);
+  remove(CS j->name);
+  }
+freejournal(b);
+}
+
+
+/* This is called when NE finishes normally. */
+
+void
+journal_endall(void)
+{
+for (bufferstr *b = main_bufferchain; b != NULL; b = b->next) journal_end(b);
+}
+
+
+
+/*************************************************
+*         Handle failure to write                *
+*************************************************/
+
+/* The journal is abandoned and no more are kept for the buffer.
+
+Arguments:
+  b          the buffer
+  name       the name of the file that failed
+
+Returns:     nothing
+*/
+
+static void
+failed(bufferstr *b, uschar *name)
+{
+/* LCOV_EXCL_START - only on disk errors */
+error_moan(80, name, strerror(errno));
+journal_end(b);
+b->nojournal = TRUE;
+/* LCOV_EXCL_STOP */
+}
+
+
+
+/*************************************************
+*        Write a copy of a buffer                *
+*************************************************/
+
+/* This writes the header and a complete copy of the buffer as the base of a
+new journal file, and forces it to the disc.
+
+Arguments:
+  f          the file
+  b          the buffer
+
+Returns:     the number of bytes in the lines, or -1 on error
+*/
+
+static long int
+checkpoint(FILE *f, bufferstr *b)
+{
+long int size = 0;
+int count = 0;
+
+for (linestr *line = buffertop(b); line != NULL; line = line->next) count++;
+fprintf(f, "%sS%d\n", header, count);
+
+for (linestr *line = buffertop(b); line != NULL; line = line->next)
+  {
+  fprintf(f, "%u:", line->len);
+  if (line->len > 0) fwrite(line->text, 1, line->len, f);
+  fputc('\n', f);
+  size += line->len;
+  }
+
+if (fflush(f) != 0 || fsync(fileno(f)) != 0 || ferror(f)) return -1;
+return size;
+}
+
+
+
+/*************************************************
+*           Start the journal file               *
+*************************************************/
+
+/* If the journal's base is the buffer's file and the file has not changed,
+the file starts with a reference to it, and the pending records are kept.
+Otherwise it starts with a copy of the buffer, and the pending records are not
+needed. A journal that already exists is not touched, because it may be from
+an editing session that failed.
+
+Arguments:
+  b          the buffer
+  j          its journal
+
+Returns:     TRUE if all went well
+*/
+
+static BOOL
+startjournal(bufferstr *b, journalstr *j)
+{
+stampstr stamp;
+long int size;
+
+j->fid = Ufopen(j->name, "wx");
+if (j->fid == NULL)
+  {
+  if (errno == EEXIST) error_moan(79, j->name, j->filename); else
+    error_moan(80, j->name, strerror(errno));   /* LCOV_EXCL_LINE */
+  freejournal(b);
+  b->nojournal = TRUE;
+  return FALSE;
+  }
+
+if (j->stamped && sys_filestamp(j->filename, NULL, &stamp) &&
+    stamp.size == j->stamp.size && stamp.mtime == j->stamp.mtime &&
+    stamp.inode == j->stamp.inode)
+  {
+  fprintf(j->fid, "%sF%ld %ld %ld\n", header, stamp.size, stamp.mtime,
+    stamp.inode);
+  size = (fflush(j->fid) == 0)? stamp.size : -1;
+  }
+else
+  {
+  j->batchlen = 0;
+  dirtyreset(j, j->dirtymax);
+  j->cacheline = buffertop(b);
+  j->cacheindex = 0;
+  size = checkpoint(j->fid, b);
+  }
+
+if (size < 0)
+  {
+  failed(b, j->name);   /* LCOV_EXCL_LINE */
+  return FALSE;         /* LCOV_EXCL_LINE */
+  }
+
+j->size = ftell(j->fid);
+j->checksize = j->size + ((size > JOURNAL_MINCHECK)? size : JOURNAL_MINCHECK);
+return TRUE;
+}
+
+
+
+/*************************************************
+*      Replace a journal with a checkpoint       *
+*************************************************/
+
+/* The new journal is written under another name and then renamed, so that
+there is always a complete journal on the disc.
+
+Arguments:
+  b          the buffer
+  j          its journal
+
+Returns:     nothing
+*/
+
+static void
+rewrite(bufferstr *b, journalstr *j)
+{
+uschar *tempname = store_Xget(Ustrlen(j->name) + 2);
+FILE *f;
+long int size = -1;
+
+sprintf(CS tempname, "%s+", j->name);
+f = Ufopen(tempname, "w");
+if (f != NULL)
+  {
+  size = checkpoint(f, b);
+  if (fclose(f) != 0) size = -1;
+  if (size >= 0 && rename(CS tempname, CS j->name) != 0) size = -1;
+  }
+
+if (size < 0)
+  {
+  /* LCOV_EXCL_START - only on disk errors */
+  remove(CS tempname);
+  failed(b, tempname);
+  store_free(tempname);
+  return;
+  /* LCOV_EXCL_STOP */
+  }
+
+store_free(tempname);
+fclose(j->fid);
+j->fid = Ufopen(j->name, "a");
+if (j->fid == NULL) { failed(b, j->name); return; }   /* LCOV_EXCL_LINE */
+fseek(j->fid, 0, SEEK_END);
+j->size = ftell(j->fid);
+j->checksize = j->size + ((size > JOURNAL_MINCHECK)? size : JOURNAL_MINCHECK);
+}
+
+
+
+/*************************************************
+*         Write out pending records              *
+*************************************************/
+
+/* This is called whenever NE is idle. For each buffer, the journal is started
+if necessary, and the pending records are written as a batch, followed by the
+texts of lines that have changed. A checkpoint is written if the journal is
+large enough.
+
+Arguments:  none
+Returns:    nothing
+*/
+
+void
+journal_flush(void)
+{
+for (bufferstr *b = main_bufferchain; b != NULL; b = b->next)
+  {
+  journalstr *j = b->journal;
+  uschar *name = buffername(b);
+
+  /* If the buffer's name has changed, its old journal is no longer needed. */
+
+  if (j != NULL && (name == NULL || Ustrcmp(name, j->filename) != 0))
+    {
+    journal_end(b);
+    j = NULL;
+    }
+
+  /* A buffer that has been changed and has no journal gets one, with a copy
+  of its contents, unless it is still being loaded. */
+
+  if (j == NULL)
+    {
+    if (!main_journal || b->nojournal || !bufferchanged(b) ||
+        b->loadfid != NULL || name == NULL || name[0] == 0)
+      continue;
+    j = newjournal(b);
+    }
+
+  /* While a save that will be the journal's base is in progress, the records
+  are kept in memory. */
+
+  if (j->fid == NULL && (j->savepid != 0 || !startjournal(b, j))) continue;
+  if (j->batchlen == 0 && j->dirtylive == 0) continue;
+
+  for (int i = 0; i < j->dirtycount; i++)
+    {
+    linestr *line = j->dirty[i];
+    int index;
+
+    if (line == NULL) continue;
+    index = lineindex(j, b, line);
+    if (index < 0) continue;
+    addrecord(j, 'T', index, 0);
+    addtext(j, line);
+    j->cacheline = line;
+    j->cacheindex = index;
+    }
+
+  addbytes(j, "E\n", 2);
+  if (fwrite(j->batch, 1, j->batchlen, j->fid) != j->batchlen ||
+      fflush(j->fid) != 0 || fsync(fileno(j->fid)) != 0)
+    {
+    failed(b, j->name);   /* LCOV_EXCL_LINE */
+    continue;             /* LCOV_EXCL_LINE */
+    }
+
+  j->size += j->batchlen;
+  j->batchlen = 0;
+  dirtyreset(j, JOURNAL_MINDIRTY);
+  if (j->size > j->checksize) rewrite(b, j);
+  }
+}
+
+
+
+/*************************************************
+*        Check whether a journal is complete     *
+*************************************************/
+
+/* This is called from the crash handler, which mentions -recover for a buffer
+whose journal is up to date.
+
+Argument:  the buffer
+Returns:   TRUE if there are no pending records
+*/
+
+BOOL
+journal_complete(bufferstr *b)
+{
+journalstr *j = b->journal;
+return j != NULL && j->fid != NULL && j->batchlen == 0 && j->dirtylive == 0;
+}
+
+
+
+/*************************************************
+*            Record changes                      *
+*************************************************/
+
+/* These functions are called for the current buffer from the undo journal's
+recording functions, and from the places that delete lines, whether or not
+undo information is being kept. Changes to lines that are not in the buffer
+(undo_suspended) are ignored.
+
+journal_text() is called before the text of a line is changed. */
+
+void
+journal_text(linestr *line)
+{
+journalstr *j = currentbuffer->journal;
+if (j != NULL && !undo_suspended) dirtyadd(j, line);
+}
+
+
+/* journal_inserted() is called after a block of lines has been linked into
+the buffer. */
+
+void
+journal_inserted(linestr *first, linestr *last, int count)
+{
+journalstr *j = currentbuffer->journal;
+int index;
+
+if (j == NULL || undo_suspended) return;
+index = lineindex(j, currentbuffer, first);
+
+/* This should never happen; the journal is abandoned, and a new one will be
+started, with a copy of the buffer. */
+
+if (index < 0)
+  {
+  journal_end(currentbuffer);   /* LCOV_EXCL_LINE */
+  return;                       /* LCOV_EXCL_LINE */
+  }
+
+addrecord(j, 'I', index, count);
+for (linestr *line = first;; line = line->next)
+  {
+  addtext(j, line);
+  if (line == last) break;
+  }
+
+j->cacheline = last;
+j->cacheindex = index + count - 1;
+}
+
+
+/* journal_removed() is called after a block of lines has been unlinked from
+the buffer, before the lines are freed. Its arguments are the first line, the
+number of lines, and the line that preceded the block, or NULL. */
+
+void
+journal_removed(linestr *first, int count, linestr *prev)
+{
+journalstr *j = currentbuffer->journal;
+int index = 0;
+
+if (j == NULL || undo_suspended) return;
+if (prev != NULL)
+  {
+  index = lineindex(j, currentbuffer, prev);
+  if (index < 0)
+    {
+    journal_end(currentbuffer);   /* LCOV_EXCL_LINE */
+    return;                       /* LCOV_EXCL_LINE */
+    }
+  index++;
+  }
+
+if (j->dirtylive > 0)
+  {
+  linestr *line = first;
+  for (int i = 0; i < count; i++, line = line->next) dirtyremove(j, line);
+  }
+
+addrecord(j, 'D', index, count);
+if (prev == NULL)
+  {
+  j->cacheline = main_top;
+  j->cacheindex = 0;
+  }
+else
+  {
+  j->cacheline = prev;
+  j->cacheindex = index - 1;
+  }
+}
+
+
+
+/*************************************************
+*     Note that a buffer is the same as its file *
+*************************************************/
+
+/* journal_loaded() is called when a buffer's file has been read completely. If
+the buffer has not been changed while it was being read, the file is the base
+for its journal, which is started when NE is next idle.
+
+Arguments:
+  b          the buffer
+  f          the file that was read
+
+Returns:     nothing
+*/
+
+void
+journal_loaded(bufferstr *b, FILE *f)
+{
+uschar *name = buffername(b);
+journalstr *j;
+stampstr stamp;
+
+if (!main_journal || b->journal != NULL || bufferchanged(b) ||
+    name == NULL || name[0] == 0 || !sys_filestamp(NULL, f, &stamp))
+  return;
+j = newjournal(b);
+j->stamp = stamp;
+j->stamped = TRUE;
+}
+
+
+/* journal_saved() is called when a buffer has been saved to its own file, so
+that the file is now its journal's base. */
+
+void
+journal_saved(bufferstr *b)
+{
+journalstr *j;
+journal_end(b);
+if (!main_journal || b->nojournal) return;
+j = newjournal(b);
+j->stamped = sys_filestamp(j->filename, NULL, &(j->stamp));
+}
+
+
+/* journal_savestart() is called when a buffer is being saved to its own file
+in the background. Changes are kept in memory until the save is finished, when
+the file becomes the journal's base. */
+
+void
+journal_savestart(bufferstr *b, int pid)
+{
+journal_end(b);
+if (!main_journal || b->nojournal) return;
+newjournal(b)->savepid = pid;
+}
+
+
+/* journal_savedone() is called when a save in the background has finished. If
+it failed, the pending changes are discarded, and a new journal will be
+started with a copy of the buffer. */
+
+void
+journal_savedone(bufferstr *b, int pid, BOOL ok)
+{
+journalstr *j = b->journal;
+if (j == NULL || j->savepid != pid) return;
+if (!ok) { freejournal(b); return; }   /* LCOV_EXCL_LINE */
+j->savepid = 0;
+j->stamped = sys_filestamp(j->filename, NULL, &(j->stamp));
+}
+
+
+
+/*************************************************
+*          Read numbers and texts                *
+*************************************************/
+
+/* These are used when recovering. A number must be followed by the given
+terminator.
+
+Arguments:
+  f          the journal
+  n          where to put the number
+  term       the terminator
+
+Returns:     TRUE if all went well
+*/
+
+static BOOL
+readnumber(FILE *f, long int *n, int term)
+{
+int c = getc(f);
+int digits = 0;
+
+*n = 0;
+while (isdigit(c))
+  {
+  *n = *n * 10 + c - '0';
+  if (++digits > 18) return FALSE;
+  c = getc(f);
+  }
+return digits > 0 && c == term;
+}
+
+
+/* If new is TRUE, a line is returned; otherwise the text is skipped and NULL
+is returned. An error is distinguished by setting *ok FALSE. */
+
+static linestr *
+readtext(FILE *f, BOOL new, BOOL *ok)
+{
+long int len;
+linestr *line = NULL;
+
+*ok = FALSE;
+if (!readnumber(f, &len, ':')) return NULL;
+if (new)
+  {
+  line = store_getlbuff(len);
+  if (len > 0 && fread(line->text, 1, len, f) != (size_t)len)
+    {
+    store_freetext(line->text);
+    store_free(line);
+    return NULL;
+    }
+  line->len = len;
+  }
+else if (fseek(f, len, SEEK_CUR) != 0) return NULL;
+
+if (getc(f) != '\n')
+  {
+  if (line != NULL)
+    {
+    store_freetext(line->text);
+    store_free(line);
+    }
+  return NULL;
+  }
+
+*ok = TRUE;
+return line;
+}
+
+
+
+/*************************************************
+*       Position in the recovered lines          *
+*************************************************/
+
+/* The lines being recovered are a chain from top to bottom; a current line
+and its index are remembered, and moving to another index starts from the
+nearest of the top, the bottom, and the current line. */
+
+typedef struct {
+  linestr *top;
+  linestr *bottom;
+  linestr *line;
+  long int index;
+  long int count;
+} replaystr;
+
+static linestr *
+seek(replaystr *r, long int index)
+{
+long int d = index - r->index;
+if (d < 0) d = -d;
+
+if (index < d)
+  {
+  r->line = r->top;
+  r->index = 0;
+  }
+else if (r->count - 1 - index < d)
+  {
+  r->line = r->bottom;
+  r->index = r->count - 1;
+  }
+
+while (r->index < index) { r->line = r->line->next; r->index++; }
+while (r->index > index) { r->line = r->line->prev; r->index--; }
+return r->line;
+}
+
+
+
+/*************************************************
+*            Replay the records                  *
+*************************************************/
+
+/* The records are read up to the given offset, which is the end of the last
+complete batch. With apply FALSE they are just checked, and the offset of the
+end of the last complete batch is returned.
+
+Arguments:
+  f          the journal, positioned after the base
+  r          the lines, or NULL if not applying
+  end        where to stop
+
+Returns:     the offset of the end of the last complete batch, or -1 if
+               a record was invalid when applying
+*/
+
+static long int
+replay(FILE *f, replaystr *r, long int end)
+{
+long int good = ftell(f);
+
+while (good < end)
+  {
+  long int index, count;
+  BOOL ok;
+  int type = getc(f);
+
+  switch (type)
+    {
+    case 'E':
+    if (getc(f) != '\n') return good;
+    good = ftell(f);
+    break;
+
+    case 'T':
+    if (!readnumber(f, &index, ' ')) return (r == NULL)? good : -1;
+    if (r == NULL)
+      {
+      (void)readtext(f, FALSE, &ok);
+      if (!ok) return good;
+      }
+    else
+      {
+      linestr *new, *line;
+      if (index >= r->count) return -1;
+      new = readtext(f, TRUE, &ok);
+      if (!ok) return -1;
+      line = seek(r, index);
+      store_freetext(line->text);
+      line->text = new->text;
+      line->len = new->len;
+      store_free(new);
+      }
+    break;
+
+    case 'I':
+    if (!readnumber(f, &index, ' ') || !readnumber(f, &count, '\n') ||
+        count <= 0)
+      return (r == NULL)? good : -1;
+    if (r == NULL)
+      {
+      while (count-- > 0)
+        {
+        (void)readtext(f, FALSE, &ok);
+        if (!ok) return good;
+        }
+      }
+    else
+      {
+      linestr *next, *prev;
+      if (index > r->count) return -1;
+      next = (index == r->count)? NULL : seek(r, index);
+      prev = (next == NULL)? r->bottom : next->prev;
+      for (long int i = 0; i < count; i++)
+        {
+        linestr *line = readtext(f, TRUE, &ok);
+        if (!ok) return -1;
+        line->prev = prev;
+        if (prev == NULL) r->top = line; else prev->next = line;
+        prev = line;
+        }
+      prev->next = next;
+      if (next == NULL) r->bottom = prev; else next->prev = prev;
+      r->count += count;
+      r->line = r->top;
+      r->index = 0;
+      }
+    break;
+
+    case 'D':
+    if (!readnumber(f, &index, ' ') || !readnumber(f, &count, '\n') ||
+        count <= 0)
+      return (r == NULL)? good : -1;
+    if (r != NULL)
+      {
+      linestr *line, *prev;
+      if (index + count > r->count || count >= r->count) return -1;
+      line = seek(r, index);
+      prev = line->prev;
+      for (long int i = 0; i < count; i++)
+        {
+        linestr *next = line->next;
+        store_freetext(line->text);
+        store_free(line);
+        line = next;
+        }
+      if (line == NULL) r->bottom = prev; else line->prev = prev;
+      if (prev == NULL) r->top = line; else prev->next = line;
+      r->count -= count;
+      r->line = r->top;
+      r->index = 0;
+      }
+    break;
+
+    default:
+    return (r == NULL)? good : -1;
+    }
+  }
+
+return good;
+}
+
+
+
+/*************************************************
+*          Recover a buffer from its journal     *
+*************************************************/
+
+/* This is called from init_buffer() when -recover is set. If there is a
+journal for the buffer's file, the buffer is rebuilt from it, and the journal
+is kept for the rest of the editing session. Any batch that is incomplete is
+removed. A journal that cannot be used is left alone.
+
+Argument:  the buffer, with its file name set
+Returns:   TRUE if the buffer has been recovered
+*/
+
+BOOL
+journal_recover(bufferstr *b)
+{
+uschar *name = b->filename;
+uschar *jname;
+uschar *error = NULL;
+uschar buff[40];
+replaystr r;
+long int base, basesize, end, n;
+long int stamp[3];
+journalstr *j;
+FILE *f;
+BOOL ok = TRUE;
+
+if (name == NULL || name[0] == 0) return FALSE;
+jname = sys_journalname(name);
+f = Ufopen(jname, "r+");
+if (f == NULL)
+  {
+  store_free(jname);
+  return FALSE;
+  }
+
+r.top = r.bottom = NULL;
+r.count = 0;
+
+/* Read the header and the base. */
+
+if (Ufgets(buff, sizeof(buff), f) == NULL || Ustrcmp(buff, header) != 0)
+  {
+  error = US"not a journal";
+  goto FAILED;
+  }
+
+switch (getc(f))
+  {
+  case 'F':
+    {
+    stampstr s;
+    size_t binoffset = 0;
+    FILE *ff;
+
+    if (!readnumber(f, stamp, ' ') || !readnumber(f, stamp + 1, ' ') ||
+        !readnumber(f, stamp + 2, '\n'))
+      {
+      error = US"the base is invalid";
+      goto FAILED;
+      }
+    ff = sys_fopen(name, US"r");
+    if (ff == NULL || !sys_filestamp(NULL, ff, &s) || s.size != stamp[0] ||
+        s.mtime != stamp[1] || s.inode != stamp[2])
+      {
+      if (ff != NULL) fclose(ff);
+      error = US"the file has changed";
+      goto FAILED;
+      }
+    for (;;)
+      {
+      linestr *line = file_nextline(ff, &binoffset);
+      line->prev = r.bottom;
+      if (r.bottom == NULL) r.top = line; else r.bottom->next = line;
+      r.bottom = line;
+      r.count++;
+      if ((line->flags & lf_eof) != 0) break;
+      }
+    fclose(ff);
+    basesize = stamp[0];
+    }
+  break;
+
+  case 'S':
+  if (!readnumber(f, &n, '\n') || n <= 0)
+    {
+    error = US"the base is invalid";
+    goto FAILED;
+    }
+  while (n-- > 0)
+    {
+    linestr *line = readtext(f, TRUE, &ok);
+    if (!ok)
+      {
+      error = US"the base is incomplete";
+      goto FAILED;
+      }
+    line->prev = r.bottom;
+    if (r.bottom == NULL) r.top = line; else r.bottom->next = line;
+    r.bottom = line;
+    r.count++;
+    }
+  basesize = ftell(f);
+  break;
+
+  default:
+  error = US"the base is invalid";
+  goto FAILED;
+  }
+
+/* Find the end of the last complete batch, then apply the batches. */
+
+base = ftell(f);
+end = replay(f, NULL, BIGNUMBER);
+fseek(f, base, SEEK_SET);
+r.line = r.top;
+r.index = 0;
+if (replay(f, &r, end) < 0 || r.count <= 0)
+  {
+  error = US"a record is invalid";
+  goto FAILED;
+  }
+
+/* Remove any incomplete batch, and keep the journal for this session. */
+
+fflush(f);
+if (ftruncate(fileno(f), end) != 0 || fseek(f, 0, SEEK_END) != 0)
+  {
+  error = US"the journal could not be truncated";   /* LCOV_EXCL_LINE */
+  goto FAILED;                                      /* LCOV_EXCL_LINE */
+  }
+
+b->top = r.top;
+b->bottom = r.bottom;
+b->linecount = 0;
+for (linestr *line = r.top; line != NULL; line = line->next)
+  {
+  line->key = ++b->linecount;
+  line->flags &= ~lf_eof;
+  }
+b->bottom->flags |= lf_eof;
+b->imax = b->linecount;
+b->changed = TRUE;
+
+j = newjournal(b);
+store_free(jname);
+j->fid = f;
+j->size = end;
+j->checksize = end +
+  ((basesize > JOURNAL_MINCHECK)? basesize : JOURNAL_MINCHECK);
+return TRUE;
+
+/* Free any lines and give an error. The error is hard when NE is starting
+up. */
+
+FAILED:
+while (r.top != NULL)
+  {
+  linestr *next = r.top->next;
+  store_freetext(r.top->text);
+  store_free(r.top);
+  r.top = next;
+  }
+fclose(f);
+error_moan(81, name, jname, error);
+store_free(jname);
+return FALSE;
+}
+
+/* End of ejournal.c */
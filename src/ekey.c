@@ -2,10 +2,10 @@
 *       The E text editor - 3rd incarnation      *
 *************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2025 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: March 2025 */
+/* This file last modified: October 2026 */
 
 
 /* This file contains code for handling individual function keystrokes when
@@ -80,6 +80,69 @@ static uschar key_readonly[] = {
   1  /* ka_mscr_up */
 };
 
+/* Table of keystrokes that are obeyed while the current buffer's file is
+still being read, provided that its end is not near. */
+
+static uschar key_whileloading[] = {
+  1, /* ka_al */
+  1, /* ka_alp */
+  1, /* ka_cl */
+  1, /* ka_clb */
+  0, /* ka_co */
+  1, /* ka_csd */
+  1, /* ka_csl */
+  1, /* ka_csls */
+  1, /* ka_csle */
+  1, /* ka_csnl */
+  1, /* ka_cstl */
+  1, /* ka_cstr */
+  1, /* ka_csr */
+  1, /* ka_cssbr */
+  1, /* ka_cssl */
+  1, /* ka_csstl */
+  1, /* ka_cstab */
+  1, /* ka_csptab */
+  1, /* ka_csu */
+  1, /* ka_cswl */
+  1, /* ka_cswr */
+  0, /* ka_cu */
+  1, /* ka_dal */
+  1, /* ka_dar */
+  1, /* ka_dc */
+  0, /* ka_de */
+  0, /* ka_dl */
+  1, /* ka_dp */
+  1, /* ka_dtwl */
+  1, /* ka_dtwr */
+  0, /* ka_gm */
+  1, /* ka_join */
+  0, /* ka_lb */
+  0, /* ka_pa */
+  0, /* ka_rb */
+  1, /* ka_reshow */
+  1, /* ka_rc */
+  0, /* ka_rs */
+  0, /* ka_scbot */
+  0, /* ka_scdown */
+  1, /* ka_scleft */
+  1, /* ka_scright */
+  1, /* ka_sctop */
+  1, /* ka_scup */
+  1, /* ka_split */
+  0, /* ka_tb */
+  1, /* ka_dpleft */
+  0, /* ka_forced */
+  1, /* ka_last */
+  0, /* ka_ret */
+  0, /* ka_wbot */
+  1, /* ka_wleft */
+  1, /* ka_wright */
+  1, /* ka_wtop */
+  0, /* ka_xy */
+  0, /* ka_mscr_down */
+  1  /* ka_mscr_up */
+};
+
 
 
 /*************************************************
@@ -302,6 +365,39 @@ return FALSE;
 
 
 
+/*************************************************
+*     Wait for loading to complete if needed     *
+*************************************************/
+
+/* While the current buffer's file is still being read, keystrokes that move
+around or change lines on the screen are obeyed using what has arrived, as long
+as the end of the buffer is not on the screen or next to the current line.
+Anything else waits until the whole file has been read.
+
+Argument:  the keystroke action, or zero for a data character
+Returns:   nothing
+*/
+
+static void
+waitforload(int function)
+{
+if (currentbuffer->loadfid == NULL) return;
+
+if (function == 0 || (function >= ka_firstka && function <= ka_lastka &&
+    key_whileloading[function - ka_firstka]))
+  {
+  usint i;
+  for (i = 0; i <= window_depth; i++)
+    if (window_vector[i] == main_bottom) break;
+  if (i > window_depth && main_current != main_bottom &&
+      main_current->next != main_bottom) return;
+  }
+
+file_loadrest(currentbuffer);
+}
+
+
+
 /*************************************************
 *         Handle one data keystroke              *
 *************************************************/
@@ -324,6 +420,8 @@ if (main_readonly)
   return;
   }
 
+if (main_loading) waitforload(0);
+
 /* In UTF-8 mode, convert a character > 127 into a multibyte string. */
 
 if (allow_wide && key > 127)
@@ -356,6 +454,8 @@ if (main_overstrike && byteoffset < main_current->len)
   int clen = line_bytecount(main_current->text + byteoffset, 1);
   if (clen == blen)
     {
+    undo_text(main_current);
+    line_unshare(main_current);
     memcpy(main_current->text + byteoffset, bp, blen);
     }
   else
@@ -442,7 +542,8 @@ if appropriate. Otherwise, display the updated line. */
 
 main_current->flags |= lf_shn;
 if (cursor_col == main_rmargin) key_handle_function(s_f_lastchar);
-else if (cursor_col >= cursor_max) key_handle_function(s_f_right);
+else if (scrn_screencol(main_current, cursor_col + 1) > (int)window_width)
+  key_handle_function(s_f_right);
 else
   {
   if (waseof)   /* Display from left and display new eof line */
@@ -452,11 +553,12 @@ else
       scrn_displayline(main_bottom, cursor_row+1, cursor_offset);
     }
   else scrn_displayline(main_current, cursor_row, display_col);
-  s_move(++cursor_col - cursor_offset, cursor_row);
+  cursor_col++;
+  s_move(scrn_screencol(main_current, cursor_col), cursor_row);
   }
 
 ShowMark();        /* Might change indication of file changed */
-s_selwindow(first_window, cursor_col - cursor_offset, cursor_row);
+s_selwindow(first_window, scrn_screencol(main_current, cursor_col), cursor_row);
 }
 
 
@@ -573,9 +675,9 @@ if (cursor_col < cursor_offset)
   scrn_afterhscroll();
   }
 
-else if (cursor_col > cursor_max)
+else if (scrn_screencol(main_current, cursor_col) > (int)window_width)
   {
-  while (cursor_col > cursor_max)
+  while (scrn_screencol(main_current, cursor_col) > (int)window_width)
     {
     cursor_offset += main_hscrollamount;
     cursor_max = cursor_offset + window_width;
@@ -825,7 +927,8 @@ if (op == lb_delete)
 
 else for (;;)
   {
-  BOOL longline = line_charcount(line->text, line->len) > cursor_max + 1;
+  BOOL longline = line_column(line, line->len) > cursor_max + 1;
+  BOOL narrow = scrn_narrow(line);
   BOOL onscreen = (row >= 0 && (usint)row <= window_depth);
   int action;
 
@@ -839,7 +942,7 @@ else for (;;)
       line_leftalign(line, cursor_col, &action);
       if (onscreen)
         {
-        if (cursor_offset > 0 || cursor_col > cursor_max ||
+        if (cursor_offset > 0 || cursor_col > cursor_max || !narrow ||
             (longline && action < 0))
           {
           line->flags |= lf_shn;
@@ -848,7 +951,7 @@ else for (;;)
         else if (action > 0)
           {
           s_hscroll(0, row, window_width, row,action);
-          if (line_charcount(line->text, line->len) > cursor_max + 1)
+          if (line_column(line, line->len) > cursor_max + 1)
             scrn_invertchars(line, row, cursor_max, 1, TRUE);
           }
         else s_hscroll(0,row,window_width,row,action);
@@ -859,10 +962,11 @@ else for (;;)
     case lb_eraseright:
     if (line_offset(line, cursor_col) < line->len)
       {
+      int x = scrn_screencol(line, cursor_col);
       line_deletech(line, cursor_col, line->len - cursor_col, TRUE);
-      if (onscreen)
+      if (onscreen && x >= 0 && x <= (int)window_width)
         {
-        s_move(cursor_col - cursor_offset, row);
+        s_move(x, row);
         s_eraseright();
         }
       }
@@ -878,7 +982,7 @@ else for (;;)
         cursor_max = window_width + cursor_offset;
         scrn_afterhscroll();
         }
-      else if (longline) line->flags |= lf_shn;
+      else if (longline || !narrow) line->flags |= lf_shn;
       else s_hscroll(0, row, window_width, row,
         (int)cursor_offset - (int)cursor_col);
       }
@@ -893,7 +997,7 @@ else for (;;)
       line_deletech(line, cursor_col, count, TRUE);
       if (onscreen && count > 0)
         {
-        if (longline) line->flags |= lf_shn;
+        if (longline || !narrow) line->flags |= lf_shn;
         else s_hscroll((int)cursor_col - (int)cursor_offset, row, window_width,
           row, -count);
         }
@@ -913,7 +1017,7 @@ else for (;;)
 
       if (onscreen && count > 0)
         {
-        if (longline || cursor_col - count < cursor_offset)
+        if (longline || !narrow || cursor_col - count < cursor_offset)
           line->flags |= lf_shn;
         else
           s_hscroll(cursor_col-cursor_offset-count,row,window_width,row,-count);
@@ -985,6 +1089,8 @@ if (main_readonly && function >= ka_firstka && function <= ka_lastka &&
   return;
   }
 
+if (main_loading) waitforload(function);
+
 /* Now process the function */
 
 switch (function)
@@ -998,9 +1104,9 @@ switch (function)
 
   else if (window_vector[--mouse_row] != NULL)
     {
-    cursor_col = mouse_col + cursor_offset;
     cursor_row = mouse_row;
     main_current = window_vector[mouse_row];
+    cursor_col = scrn_charcol(main_current, mouse_col);
     }
   break;
 
@@ -1010,7 +1116,8 @@ switch (function)
   break;
 
   case ka_csr:                /* cursor right */
-  if (cursor_col - cursor_offset < screen_max_col) cursor_col++;
+  if (scrn_screencol(main_current, cursor_col + 1) <= (int)screen_max_col)
+    cursor_col++;
     else key_handle_function(s_f_right);
   break;
 
@@ -1068,10 +1175,10 @@ switch (function)
 
   case ka_cstr:               /* cursor to text right on screen */
     {
-    usint clen = line_charcount(main_current->text, main_current->len);
+    usint clen = line_column(main_current, main_current->len);
     if (clen <= cursor_offset) cursor_col = cursor_offset; else
       {
-      cursor_col = cursor_offset + window_width;
+      cursor_col = scrn_charcol(main_current, window_width);
       if (cursor_col >= clen) cursor_col = clen;
       }
     }
@@ -1118,7 +1225,7 @@ switch (function)
     main_current = window_vector[i];
     while (main_current == NULL) main_current = window_vector[--i];
     cursor_row = i;
-    cursor_col = window_width + cursor_offset;
+    cursor_col = scrn_charcol(main_current, window_width);
     }
   break;
 
@@ -1159,7 +1266,7 @@ switch (function)
         }
       }
     }
-  cursor_col = line_charcount(main_current->text, cursor_byte);
+  cursor_col = line_column(main_current, cursor_byte);
   adjustscroll();
   break;
 
@@ -1191,7 +1298,7 @@ switch (function)
       else break;
       }
     }
-  cursor_col = line_charcount(main_current->text, cursor_byte);
+  cursor_col = line_column(main_current, cursor_byte);
   adjustscroll();
   break;
 
@@ -1200,7 +1307,7 @@ switch (function)
   break;
 
   case ka_csle:               /* cursor to true line end */
-  cursor_col = line_charcount(main_current->text, main_current->len);
+  cursor_col = line_column(main_current, main_current->len);
   adjustscroll();
   break;
 
@@ -1255,7 +1362,7 @@ switch (function)
     linestr *lineold = main_current;
 
     cursor_byte = line_soffset(p, p + main_current->len, cursor_col);
-    s_move(cursor_col - cursor_offset, cursor_row);
+    s_move(scrn_screencol(main_current, cursor_col), cursor_row);
     GETCHAR(c, (p + cursor_byte), p + main_current->len);
     s_putc(c);
 
@@ -1269,9 +1376,10 @@ switch (function)
         }
       }
 
-    if (cursor_col >= cursor_offset && cursor_col <= cursor_max)
+    if (cursor_col >= cursor_offset &&
+        scrn_screencol(main_current, cursor_col) <= (int)window_width)
       {
-      s_move(cursor_col - cursor_offset, cursor_row);
+      s_move(scrn_screencol(main_current, cursor_col), cursor_row);
       s_eraseright();
       }
 
@@ -1328,7 +1436,7 @@ switch (function)
     linestr *prev = main_current->prev;
     if (prev != NULL)
       {
-      cursor_col = line_charcount(prev->text, prev->len);
+      cursor_col = line_column(prev, prev->len);
       if (cursor_col > cursor_max)
         {
         cursor_offset = cursor_col/main_hscrollamount;
@@ -1426,7 +1534,7 @@ switch (function)
     linestr *prev = main_current->prev;
     if (prev != NULL)
       {
-      cursor_col = line_charcount(prev->text, prev->len);
+      cursor_col = line_column(prev, prev->len);
       if ((main_current->flags & lf_eof) != 0)
         {
         main_current = prev;
@@ -1747,7 +1855,8 @@ if (!main_done && currentbuffer != NULL)
   {
   scrn_display();   /* Adjusts cursor_row */
   ShowMark();
-  s_selwindow(first_window, cursor_col - cursor_offset, cursor_row);
+  s_selwindow(first_window, scrn_screencol(main_current, cursor_col),
+    cursor_row);
   }
 }
 
@@ -2,10 +2,10 @@
 *       The E text editor - 3rd incarnation      *
 *************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2023 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: February 2023 */
+/* This file last modified: October 2026 */
 
 
 /* This file contains code for making changes to individual lines */
@@ -31,13 +31,124 @@ Returns:      the byte offset
 int
 line_soffset(uschar *s, uschar *e, int c)
 {
-uschar *ss = s;
-while (c > 0 && ss < e)
+if (c <= 0 || !allow_wide) return c;
+return utf8_offset(s, e - s, c, 0);
+}
+
+
+
+/*************************************************
+*        Check whether a line is valid UTF-8     *
+*************************************************/
+
+/* Lines are checked as they are read from a file, and otherwise the first
+time it matters. The result is remembered in the line's flags until the text
+is changed, so that scanning the text, displaying it, and matching it need not
+check again.
+
+Argument:  the line
+Returns:   TRUE if the text is valid UTF-8
+*/
+
+BOOL
+line_isutf8(linestr *line)
+{
+if ((line->flags & (lf_utf8|lf_badutf8)) == 0)
+  line->flags |= utf8_valid(line->text, line->len)? lf_utf8 : lf_badutf8;
+return (line->flags & lf_utf8) != 0;
+}
+
+
+
+/*************************************************
+*         Character indexes for lines            *
+*************************************************/
+
+/* When UTF-8 is in use, converting between character columns and byte offsets
+means scanning the line. This matters for very long lines, because it happens
+for each keystroke. A line whose text has no multibyte characters has lf_ascii
+set, and then the column and the offset are the same. For a long line that has
+multibyte characters, an index holding the byte offset of every
+CHARINDEX_STEP'th character is built when it is first needed, so that at most
+CHARINDEX_STEP characters have to be scanned.
+
+The indexes for the most recently used lines are kept here. A line has lf_index
+set when it has been given an index. These bits are cleared by undo_text(),
+which is called before a line's text is changed, and an index is used only if
+the text's address and length are also unchanged, so an index never survives
+the freeing of its line or text. */
+
+typedef struct {
+  linestr *line;             /* the line */
+  uschar  *text;             /* its text when the index was built */
+  usint    len;              /* its length when the index was built */
+  usint    chars;            /* number of characters in the text */
+  usint   *offsets;          /* byte offsets of every CHARINDEX_STEP'th char */
+  usint    count;            /* number of offsets */
+  usint    max;              /* size of the offsets vector */
+} charindexstr;
+
+static charindexstr charindex[CHARINDEX_CACHE];
+static int charindex_next = 0;
+
+
+/* Find the index for a line, building it if necessary. If the line turns out
+to have no multibyte characters, lf_ascii is set and NULL is returned.
+
+Argument:  the line, which is not empty, and has been checked for UTF-8
+Returns:   the index or NULL
+*/
+
+static charindexstr *
+getindex(linestr *line)
+{
+charindexstr *ix;
+usint chars, offset, n;
+
+if ((line->flags & lf_index) != 0)
   {
-  SKIPCHAR(ss, e);
-  c--;
+  for (int i = 0; i < CHARINDEX_CACHE; i++)
+    {
+    ix = charindex + i;
+    if (ix->line == line && ix->text == line->text && ix->len == line->len)
+      return ix;
+    }
   }
-return ss - s + c;
+
+chars = utf8_count(line->text, line->len, line->flags);
+if (chars == line->len)
+  {
+  line->flags |= lf_ascii;
+  return NULL;
+  }
+
+/* Re-use the least recently built index. */
+
+ix = charindex + charindex_next;
+charindex_next = (charindex_next + 1) % CHARINDEX_CACHE;
+n = line->len/CHARINDEX_STEP + 1;
+if (ix->max < n)
+  {
+  store_free(ix->offsets);
+  ix->offsets = store_Xget(n * sizeof(usint));
+  ix->max = n;
+  }
+
+ix->line = line;
+ix->text = line->text;
+ix->len = line->len;
+ix->chars = chars;
+ix->count = 0;
+
+for (offset = 0; ix->count * CHARINDEX_STEP < chars;)
+  {
+  ix->offsets[ix->count++] = offset;
+  offset += utf8_offset(line->text + offset, line->len - offset,
+    CHARINDEX_STEP, line->flags);
+  }
+
+line->flags |= lf_index;
+return ix;
 }
 
 
@@ -48,7 +159,7 @@ return ss - s + c;
 
 /* Given a character column, scan the line to find the byte offset. If the
 character column is past the end of the line, behave as if there were following
-spaces.
+spaces. A long line is scanned from the nearest point in its index.
 
 Arguments:
   line      the line structure
@@ -60,16 +171,83 @@ Returns:    the byte offset
 usint
 line_offset(linestr *line, int col)
 {
-uschar *pe;
-uschar *p = line->text;
-if (p == NULL) return col;  /* Empty line may be NULL with zero length */
-pe = p + line->len;
-while (col > 0 && p < pe)
+usint offset = 0;
+if (line->text == NULL) return col;  /* Empty line may be NULL with zero length */
+if (!allow_wide || (line->flags & lf_ascii) != 0 || col <= 0) return col;
+(void)line_isutf8(line);
+
+if (line->len >= CHARINDEX_MIN)
   {
-  SKIPCHAR(p, pe);
-  col--;
+  charindexstr *ix = getindex(line);
+  if (ix == NULL) return col;
+  if ((usint)col >= ix->chars) return line->len + col - ix->chars;
+  offset = ix->offsets[col/CHARINDEX_STEP];
+  col %= CHARINDEX_STEP;
+  }
+
+return offset + utf8_offset(line->text + offset, line->len - offset, col,
+  line->flags);
+}
+
+
+
+/* Count the characters in part of a line, starting at a character. The
+knowledge that the line is valid UTF-8 can be used only if the part does not
+end inside a character. */
+
+static usint
+linecount(linestr *line, usint start, usint end)
+{
+usint flags = line->flags;
+if (end <= start) return 0;
+if (end < line->len && (line->text[end] & 0xc0) == 0x80) flags &= ~lf_utf8;
+return utf8_count(line->text + start, end - start, flags);
+}
+
+
+
+/*************************************************
+*    Get character column for byte in line       *
+*************************************************/
+
+/* This is the inverse of line_offset(): it counts the characters in the first
+part of a line. An offset past the end of the line behaves as if there were
+following spaces. A long line is counted from the nearest point in its index.
+
+Arguments:
+  line      the line structure
+  offset    the byte offset
+
+Returns:    the character column
+*/
+
+usint
+line_column(linestr *line, usint offset)
+{
+charindexstr *ix;
+usint bot, top;
+
+if (!allow_wide || (line->flags & lf_ascii) != 0) return offset;
+if (offset > line->len)
+  return line_column(line, line->len) + offset - line->len;
+(void)line_isutf8(line);
+if (line->len < CHARINDEX_MIN) return linecount(line, 0, offset);
+
+ix = getindex(line);
+if (ix == NULL) return offset;
+if (offset == line->len) return ix->chars;
+
+/* Find the last indexed character that starts at or before the offset. */
+
+bot = 0;
+top = ix->count;
+while (top - bot > 1)
+  {
+  usint mid = (bot + top)/2;
+  if (ix->offsets[mid] <= offset) bot = mid; else top = mid;
   }
-return p - line->text + col;
+
+return bot * CHARINDEX_STEP + linecount(line, ix->offsets[bot], offset);
 }
 
 
@@ -90,16 +268,8 @@ Returns:     the character count
 usint
 line_charcount(uschar *ptr, usint len)
 {
-uschar *pe;
-int yield = 0;
 if (len == 0) return 0;  /* Avoids problem if ptr is NULL */
-pe = ptr + len;
-while (ptr < pe)
-  {
-  SKIPCHAR(ptr, pe);
-  yield++;
-  }
-return yield;
+return allow_wide? utf8_count(ptr, len, 0) : len;
 }
 
 
@@ -154,18 +324,45 @@ return (up == NULL)? -1 : count;
 *             Make a copy of a line              *
 *************************************************/
 
+/* The text is shared with the original line, so this costs the same however
+long the line is. */
+
 linestr *
 line_copy(linestr *line)
 {
-linestr *nline = store_getlbuff(line->len);
+linestr *nline = store_getlbuff(0);
+nline->text = store_sharetext(line->text);
+nline->len = line->len;
 nline->key = line->key;
-nline->flags = line->flags;
-if (line->len > 0) memcpy(nline->text, line->text, line->len);
+nline->flags = line->flags & ~(lf_index|lf_layout|lf_rowstart);
 return nline;
 }
 
 
 
+/*************************************************
+*          Make a line's text private            *
+*************************************************/
+
+/* This must be called before a line's text is altered in place, in case it is
+shared with another line.
+
+Argument:  the line
+Returns:   nothing
+*/
+
+void
+line_unshare(linestr *line)
+{
+uschar *text = line->text;
+if (!store_textshared(text)) return;
+line->text = (line->len == 0)? NULL : store_Xgettext(line->len);
+if (line->len > 0) memcpy(line->text, text, line->len);
+store_freetext(text);
+}
+
+
+
 /*************************************************
 *           Insert bytes into a line             *
 *************************************************/
@@ -193,7 +390,7 @@ usint oldlen = line->len;
 usint extra, newlen;
 usint leftcount, rightcount;
 usint col, bcol;
-uschar *newtext, *np;
+uschar *oldtext, *np;
 
 /* Set up according to byte or character offset */
 
@@ -204,28 +401,44 @@ if (abcol < 0)    /* Character offset given */
   }
 else              /* Byte offset given */
   {
-  col = line_charcount(line->text, abcol);
+  col = line_column(line, abcol);
   bcol = (usint)abcol;
   }
 
-/* Now do the business */
+/* Now do the business. If the text is not shared and has room, the insertion
+is done in place, so that only the bytes to the right of it move; this is the
+common case of typing at the cursor. Otherwise a new block is obtained, with
+room to spare so that the next insertion can be done in place. The inserted
+string might be part of the old text, so that is freed only at the end. */
 
+undo_text(line);
 extra = (bcol > oldlen)? bcol - oldlen : 0;
 newlen = oldlen + extra + count + padcount;
-newtext = store_Xget(newlen);
-np = newtext;
-
+oldtext = line->text;
 leftcount = (extra == 0)? bcol : oldlen;
 rightcount = (oldlen >= bcol)? oldlen - bcol : 0;
 
-/* Before each memcpy(), check for a zero length, because ptr or line->text may
-be NULL when using this function just for padding. */
-
-if (leftcount > 0)
+if (newlen <= store_textsize(oldtext) && !store_textshared(oldtext) &&
+    (ptr == NULL || ptr < oldtext || ptr >= oldtext + oldlen))
+  {
+  np = oldtext + leftcount;
+  if (rightcount > 0)
+    memmove(np + extra + count + padcount, oldtext + bcol, rightcount);
+  oldtext = NULL;
+  }
+else
   {
-  memcpy(np, line->text, leftcount);
-  np += leftcount;
+  line->text = store_Xgettext(newlen + TEXT_ROOM(newlen));
+  np = line->text + leftcount;
+
+  /* Before each memcpy(), check for a zero length, because ptr or the old
+  text may be NULL when using this function just for padding. */
+
+  if (leftcount > 0) memcpy(line->text, oldtext, leftcount);
+  if (rightcount > 0)
+    memcpy(np + extra + count + padcount, oldtext + bcol, rightcount);
   }
+
 for (usint i = 0; i < extra; i++) *np++ = ' ';
 if (count > 0)
   {
@@ -233,10 +446,8 @@ if (count > 0)
   np += count;
   }
 for (usint i = 0; i < padcount; i++) *np++ = ' ';
-if (rightcount > 0) memcpy(np, line->text + bcol, rightcount);
 
-if (line->text != NULL) store_free(line->text);
-line->text = newtext;
+store_freetext(oldtext);
 line->len = newlen;
 
 /* If we have added data to the end-of-file line, make a new, null eof line and
@@ -250,6 +461,7 @@ if ((line->flags & lf_eof) != 0)
   line->flags &= ~lf_eof;
   main_bottom->flags |= lf_eof + lf_shn;
   main_linecount++;
+  undo_inserted(main_bottom, main_bottom, 1);
 
   if (extra == 0)
     {
@@ -281,6 +493,34 @@ cmd_recordchanged(line, col + count + padcount);
 
 
 
+/*************************************************
+*        Give back spare room in lines           *
+*************************************************/
+
+/* Lines that have been edited may have room to spare in their text blocks
+(see line_insertbytes()). This is given back when lines are written to a file,
+because editing of them is likely to be over by then, so that the memory is not
+held for ever. Shared text is left alone by store_choptext().
+
+Arguments:
+  line      the first line
+  last      the last line, or NULL to go on to the end of the buffer
+
+Returns:    nothing
+*/
+
+void
+line_trimroom(linestr *line, linestr *last)
+{
+for (; (line->flags & lf_eof) == 0; line = line->next)
+  {
+  store_choptext(line->text, line->len);
+  if (line == last) break;
+  }
+}
+
+
+
 /*************************************************
 *        Delete chars or bytes from line         *
 *************************************************/
@@ -320,7 +560,7 @@ if (line->text == NULL) return;    /* Empty line */
 
 if (col < 0)
   {
-  col = line_charcount(line->text, bcol);
+  col = line_column(line, bcol);
   count = line_charcount(line->text + bcol, bcount);
   }
 
@@ -374,7 +614,7 @@ if (main_undelete == NULL || (main_undelete->flags & lf_udch) == 0 ||
     linestr *prev = main_lastundelete->prev;
     if (prev == NULL) break;   /* Should not occur */
     prev->next = NULL;
-    store_free(main_lastundelete->text);
+    store_freetext(main_lastundelete->text);
     store_free(main_lastundelete);
     main_lastundelete = prev;
     main_undeletecount--;
@@ -411,12 +651,25 @@ else
 main_undelete->len = t - main_undelete->text;
 
 /* Close up the line, adjust its length, mark it changed, and sort out the mark
-positions if necessary. */
+positions if necessary. If the text is shared, build a new copy without the
+deleted bytes. */
 
-line->len -= b - a;
-memmove(a, b, z - b);
-
-store_chop(line->text, line->len);
+undo_text(line);
+if (store_textshared(line->text))
+  {
+  uschar *newtext = store_Xgettext(line->len - (b - a));
+  memcpy(newtext, line->text, a - line->text);
+  memcpy(newtext + (a - line->text), b, z - b);
+  store_freetext(line->text);
+  line->text = newtext;
+  line->len -= b - a;
+  }
+else
+  {
+  line->len -= b - a;
+  memmove(a, b, z - b);
+  store_choptext(line->text, line->len + TEXT_ROOM(line->len));
+  }
 cmd_recordchanged(line, backcol);
 
 if (mark_line == line)
@@ -485,7 +738,9 @@ line_deletepart(line, -1, -1, offset, count, forwardsflag);
 *************************************************/
 
 /* The line is either added to the "deleted" list, so that it can be undeleted,
-or completely discarded.
+or completely discarded. However, if changes are being recorded for undoing,
+the line itself is handed to the undo journal, and the deleted list gets a
+copy.
 
 Arguments:
   line        line to be deleted
@@ -499,6 +754,7 @@ line_delete(linestr *line, BOOL undelete)
 {
 linestr *prevline = line->prev;
 linestr *nextline = line->next;
+BOOL journal = undo_active();
 
 nextline->prev = prevline;
 if (prevline == NULL) main_top = nextline; else prevline->next = nextline;
@@ -508,24 +764,30 @@ only so many lines on the list. */
 
 if (undelete)
   {
-  line->prev = NULL;
-  line->next = main_undelete;
-  if (main_lastundelete == NULL) main_lastundelete = line;
-    else main_undelete->prev = line;
-  main_undelete = line;
+  linestr *uline = journal? store_copyline(line) : line;
+  uline->prev = NULL;
+  uline->next = main_undelete;
+  if (main_lastundelete == NULL) main_lastundelete = uline;
+    else main_undelete->prev = uline;
+  main_undelete = uline;
   main_undeletecount++;
   while (main_undeletecount > max_undelete)
     {
     linestr *prev = main_lastundelete->prev;
     if (prev == NULL) break;   /* Should not occur */
     prev->next = NULL;
-    store_free(main_lastundelete->text);
+    store_freetext(main_lastundelete->text);
     store_free(main_lastundelete);
     main_lastundelete = prev;
     main_undeletecount--;
     }
   }
 
+/* If recording for undo, pass the line to the journal. */
+
+journal_removed(line, 1, prevline);
+if (journal) undo_removed(line, line, 1, prevline, nextline);
+
 /* Otherwise free the line's memory. If we are in screen mode, ensure that the
 table of lines that are currently displayed does not contain the line we are
 about to throw away. This is necessary because a new line could be read before
@@ -533,7 +795,7 @@ re-display happens, and it might re-use the same block of memory, leading to
 confusion. We can't set the value to NULL, as that implies the screen line is
 blank. Use (+1) and assume that will never be a valid line address... */
 
-else
+else if (!undelete)
   {
   if (main_screenOK)
     {
@@ -541,7 +803,7 @@ else
       if (window_vector[i] == line) window_vector[i] = (linestr *)(+1);
     }
 
-  store_free(line->text);
+  store_freetext(line->text);
   store_free(line);
   }
 
@@ -661,6 +923,7 @@ usint newlen = (line->len > bcol)? line->len - bcol : 0;
 linestr *splitline = store_getlbuff(newlen);
 linestr *nextline = line->next;
 
+undo_text(line);
 splitline->prev = line;
 if (nextline == NULL) main_bottom = splitline;
   else nextline->prev = splitline;
@@ -704,7 +967,7 @@ else if ((line->flags & lf_clend) != 0)
 if (bcol < line->len)
   {
   line->len = bcol;
-  store_chop(line->text, bcol);
+  store_choptext(line->text, bcol);
   }
 splitline->len = newlen;
 
@@ -721,6 +984,7 @@ if ((line->flags & lf_eof) != 0)
 cmd_recordchanged(splitline, 0);
 
 main_linecount++;
+undo_inserted(splitline, splitline, 1);
 return splitline;
 }
 
@@ -745,10 +1009,11 @@ line_concat(linestr *line, int padcount)
 {
 linestr *prev = line->prev;
 int newlen = line->len + prev->len + padcount;
-int backcol = line_charcount(prev->text, prev->len);
-uschar *newtext = store_Xget(newlen);
+int backcol = line_column(prev, prev->len);
+uschar *newtext = store_Xgettext(newlen + TEXT_ROOM(newlen));
 uschar *p;
 
+undo_text(line);
 if (mark_line == line) mark_col += backcol + padcount;
 if (mark_line_global == line) mark_col_global += backcol + padcount;
 
@@ -757,7 +1022,7 @@ for (p = newtext + prev->len; p < newtext + prev->len + padcount; p++) *p = ' ';
 if (line->len > 0)
   memcpy(newtext + prev->len + padcount, line->text, line->len);
 
-store_free(line->text);
+store_freetext(line->text);
 line->text = newtext;
 line->len = newlen;
 line->key = prev->key;
@@ -818,7 +1083,7 @@ for (usint n = 1, i = 0; i < n; i++)
     127 if either the terminal is UTF-8 or if eightbit is set. Output the
     character when i == 0; otherwise output a space. */
 
-    if (c < 256 && (ch_displayable[c/8] & (1<<(c%8))) == 0)
+    if (c < 256 && ch_width(c) != 0)
       {
       if (c < 127)
         {
@@ -962,20 +1227,8 @@ return FALSE;
 }
 
 
-/* Functions for helping decide whether to concatenate lines. The first
-computes the number of character spaces left, where width is the splitting
-character column. The returned value allows for one space to be inserted at the
-join. */
-
-static usint
-spaceleft(linestr *line, usint width)
-{
-usint yield = width - line_charcount(line->text, line->len);
-if (line->len > 0 && line->text[line->len-1] != ' ') yield--;
-return yield;
-}
-
-/* Return the length in characters of the first word in a line. */
+/* Return the length in characters of the first word in a line; this helps
+decide whether to concatenate lines. */
 
 static usint
 firstwordlen(linestr *line)
@@ -992,16 +1245,160 @@ while (p < pe)
 return n;
 }
 
-/* Function to remove trailing spaces in a line */
+/* The paragraph being formatted is assembled in a working buffer that holds
+the text of its current line. Each time a line is finished it is copied out,
+and the remainder is kept in the buffer, so that a long line is not copied
+again for each piece that is split off it. The text is held between fmt_start
+and fmt_end; there may be free space before and after it. The buffer is kept
+from one paragraph to the next: getting and freeing it for each paragraph
+leaves a trail of small fragments in the store's free queue, which every later
+request for a line's text then has to walk past. Only a buffer that has grown
+large for a very long paragraph is given back. */
+
+static uschar *fmt_buff;
+static usint fmt_size;
+static usint fmt_start;
+static usint fmt_end;
+
+/* Ensure there is room for n more bytes after the text. The text is moved down
+if that leaves at least half the buffer free; otherwise a buffer twice as big
+as is needed is obtained. */
 
 static void
-detrail(linestr *line)
+fmt_room(usint n)
 {
-int i;
-uschar *p = line->text;
-for (i = line->len - 1; i >= 0; i--) if (p[i] != ' ') break;
-line->len = i + 1;
-store_chop(line->text, line->len);
+usint len = fmt_end - fmt_start;
+if (fmt_end + n <= fmt_size) return;
+
+if (len + n <= fmt_size/2)
+  {
+  memmove(fmt_buff, fmt_buff + fmt_start, len);
+  }
+else
+  {
+  usint newsize = 2*(len + n) + 256;
+  uschar *newbuff = store_Xget(newsize);
+  if (len > 0) memcpy(newbuff, fmt_buff + fmt_start, len);
+  store_free(fmt_buff);
+  fmt_buff = newbuff;
+  fmt_size = newsize;
+  }
+
+fmt_start = 0;
+fmt_end = len;
+}
+
+/* Add pad spaces followed by n bytes to the end of the text. */
+
+static void
+fmt_append(usint pad, uschar *s, usint n)
+{
+fmt_room(pad + n);
+memset(fmt_buff + fmt_end, ' ', pad);
+if (n > 0) memcpy(fmt_buff + fmt_end + pad, s, n);
+fmt_end += pad + n;
+}
+
+/* Remove drop bytes from the start of the text, and then make room for n new
+bytes there, returning their address. */
+
+static uschar *
+fmt_prepend(usint drop, usint n)
+{
+fmt_start += drop;
+if (fmt_start >= n)
+  {
+  fmt_start -= n;
+  return fmt_buff + fmt_start;
+  }
+fmt_room(n);
+memmove(fmt_buff + n, fmt_buff + fmt_start, fmt_end - fmt_start);
+fmt_end += n - fmt_start;
+fmt_start = 0;
+return fmt_buff;
+}
+
+/* Remove trailing spaces from the text. */
+
+static void
+fmt_detrail(void)
+{
+while (fmt_end > fmt_start && fmt_buff[fmt_end - 1] == ' ') fmt_end--;
+}
+
+/* Check whether the text is more than width characters long, without counting
+further than that. An "infinite" width is used for unformatting. */
+
+static BOOL
+fmt_wider(usint width)
+{
+usint len = fmt_end - fmt_start;
+if (width == (usint)(-1)) return FALSE;
+if (!allow_wide) return len > width;
+return utf8_offset(fmt_buff + fmt_start, len, width, 0) < len;
+}
+
+/* Compute the number of character spaces left in the text, which is known not
+to be wider than the width. The returned value allows for one space to be
+inserted at a join. */
+
+static usint
+fmt_spaceleft(usint width)
+{
+usint len = fmt_end - fmt_start;
+usint yield = width - line_charcount(fmt_buff + fmt_start, len);
+if (len > 0 && fmt_buff[fmt_end - 1] != ' ') yield--;
+return yield;
+}
+
+/* Put a finished line of the paragraph into the buffer. The lines that have
+already been taken into the working buffer are re-used in order, and are
+changed only if their text or key is different. If there are no more of them,
+a new line is inserted before the next line of the paragraph.
+
+Arguments:
+  out       the next line to be re-used, or nextline
+  nextline  the first line that has not yet been taken into the paragraph
+  s         the text
+  len       its length
+  key       the line's key
+
+Returns:    the next line to be re-used
+*/
+
+static linestr *
+fmt_putline(linestr *out, linestr *nextline, uschar *s, usint len, usint key)
+{
+if (out == nextline)
+  {
+  linestr *line = store_getlbuff(len);
+  if (len > 0) memcpy(line->text, s, len);
+  line->key = key;
+  line->flags |= lf_shn;
+  line->prev = nextline->prev;
+  line->next = nextline;
+  nextline->prev->next = line;
+  nextline->prev = line;
+  main_linecount++;
+  undo_inserted(line, line, 1);
+  cmd_recordchanged(line, 0);
+  return nextline;
+  }
+
+if (out->len != len || out->key != key ||
+    (len > 0 && memcmp(out->text, s, len) != 0))
+  {
+  undo_text(out);
+  store_freetext(out->text);
+  out->text = (len == 0)? NULL : store_Xgettext(len);
+  if (len > 0) memcpy(out->text, s, len);
+  out->len = len;
+  out->key = key;
+  out->flags |= lf_shn;
+  cmd_recordchanged(out, 0);
+  }
+
+return out->next;
 }
 
 
@@ -1043,6 +1440,7 @@ cutline->flags |= lf_shn;
 
 if (!copyflag)
   {
+  undo_text(line);
   if (bright >= line->len)
     {
     if (bleft < line->len)
@@ -1087,8 +1485,10 @@ usint leftbuflen = 0;
 usint minlen = 0;
 usint width = main_rmargin;
 usint len;
+usint key;
 BOOL one_line_para;
 linestr *nextline = main_current->next;
+linestr *out;
 
 /* If unformatting, set the width "infinite"; otherwise, if margin is disabled,
 use the remembered value */
@@ -1195,29 +1595,41 @@ if (!one_line_para)
     }
   }
 
-/* Start of main loop - exit by return. */
+/* Start of main loop - exit by return. The paragraph is formatted in the same
+way as it would be if the current line were repeatedly split or joined with
+the next line, but the current line is kept in the working buffer, each
+finished line is put into the buffer once, and the next line is always an
+unchanged line that is not yet part of the paragraph. */
+
+fmt_start = fmt_end = 0;
+if (fmt_buff == NULL)
+  {
+  fmt_size = 2*main_current->len + 256;
+  fmt_buff = store_Xget(fmt_size);
+  }
+fmt_append(0, main_current->text, main_current->len);
+key = main_current->key;
+out = main_current;
 
 for (;;)
   {
-  detrail(main_current);
+  fmt_detrail();
 
   /* Loop until current line is short enough, counting characters, not bytes. */
 
-  while(line_charcount(main_current->text, main_current->len) > width)
+  while (fmt_wider(width))
     {
-    BOOL ended;
     BOOL gotspace;
     usint ichar;
     usint ibyte;
-    usint jchar;
     usint jbyte;
     usint widthoffset;
+    uschar *s = fmt_buff + fmt_start;
 
-    cmd_recordchanged(main_current, 0);
-    p = main_current->text;
-    q = main_current->text + main_current->len;
+    p = s;
+    q = fmt_buff + fmt_end;
     for (ichar = 0; ichar < width; ichar++) SKIPCHAR(p, q);
-    widthoffset = p - main_current->text;
+    widthoffset = p - s;
 
     /* We now have ichar at the maximum width character offset and p pointing
     after the last possible character that can be on this line. We want to
@@ -1234,112 +1646,85 @@ for (;;)
         gotspace = TRUE;
         break;
         }
-      BACKCHAR(p, main_current->text);
+      BACKCHAR(p, s);
       if (ichar == minlen) break;
       ichar--;
       }
 
     /* If we have not found a breaking space, break at the character width. In
-    both cases we now set i.. to the ending offsets and j.. to the start of the
-    rest of the line offsets. */
+    both cases we now set ibyte to the end of this line and jbyte to the start
+    of the rest of the text. */
 
     if (!gotspace)
       {
       ibyte = jbyte = widthoffset;
-      ichar = jchar = width;
       }
     else
       {
-      uschar *pj;
-      ibyte = p - main_current->text;
+      ibyte = p - s;
       jbyte = ibyte + 1;
-      jchar = ichar + 1;
 
-      /* Advance j.. to pass over any spaces */
+      /* Advance jbyte to pass over any spaces */
 
-      pj = p + 1;
-      while (jbyte < main_current->len)
-        {
-        if (*pj++ == ' ')
-          {
-          jbyte++;
-          jchar++;
-          }
-        else break;
-        }
+      while (s + jbyte < q && s[jbyte] == ' ') jbyte++;
 
-      /* Reverse i.. to cut off trailing spaces */
+      /* Reverse ibyte to cut off trailing spaces */
 
-      while (ibyte > minlen && *(--p) == ' ')
-        {
-        ibyte--;
-        ichar--;
-        }
+      while (ibyte > minlen && *(--p) == ' ') ibyte--;
       }
 
-    /* If next is paragraph end, make a new part line and make it the current
-    line. */
-
-    ended = parend(nextline, indent, indent2, leftbuf, leftbuflen);
+    out = fmt_putline(out, nextline, s, ibyte, key);
 
-    /* The next line is not to be included in this paragraph. So what we split
-    off this line must become a new line on its own. */
+    /* If the next line is not to be included in this paragraph, what is left
+    becomes a new line on its own, with any indent, tag, or second indent
+    inserted. */
 
-    if (ended)
+    if (parend(nextline, indent, indent2, leftbuf, leftbuflen))
       {
-      linestr *extra = line_cutpart(main_current, jchar,
-        line_charcount(main_current->text, main_current->len), FALSE);
-      main_current->len -= jbyte - ibyte;
-      if (main_current->len == widthoffset) main_current->flags |= lf_shn;
-      main_current->next = extra;
-      extra->next = nextline;
-      nextline->prev = extra;
-      extra->prev = main_current;
-      main_current = extra;
-      main_linecount++;
-
-      /* If there's an indent or a tag or 2nd line indent, insert them. */
-
-      if (indent > 0) line_insertbytes(main_current, 0, -1, NULL, 0, indent);
-      if (leftbuflen > 0)
-        line_insertbytes(main_current, indent, -1, leftbuf, leftbuflen, 0);
-      if (indent2 > 0)
-        line_insertbytes(main_current, minlen, -1, NULL, 0, indent2);
+      p = fmt_prepend(jbyte, minlen + indent2);
+      memset(p, ' ', indent);
+      memcpy(p + indent, leftbuf, leftbuflen);
+      memset(p + minlen, ' ', indent2);
+      key = 0;
       }
 
-    /* Otherwise, move text onto the start of the next line, and make it the
-    current line. We know that if there's an indent or tag, or second indent,
-    they will exist on the next line, so just insert after them. */
+    /* Otherwise, the rest goes onto the start of the next line, after any
+    indent, tag, or second indent, and that becomes the current line. */
 
     else
       {
-      line_insertbytes(nextline, indent + leftbuflen + indent2, -1,
-        main_current->text + jbyte,
-        main_current->len - jbyte, 1);
-      nextline->flags |= lf_shn;
-      main_current->len = ibyte;               /* shorten current */
-      if (main_current->len == widthoffset) main_current->flags |= lf_shn;
-        else main_current->flags |= lf_clend;  /* clear out end */
-      main_current = nextline;
+      usint bcol = line_offset(nextline, minlen + indent2);
+      usint left = (bcol > nextline->len)? nextline->len : bcol;
+
+      p = fmt_prepend(jbyte, bcol);
+      if (left > 0) memcpy(p, nextline->text, left);
+      memset(p + left, ' ', bcol - left);
+      fmt_append(1, nextline->text + left, nextline->len - left);
+      key = nextline->key;
       nextline = nextline->next;
       }
 
-    detrail(main_current);                     /* includes store_chop() */
+    fmt_detrail();
     }
 
   /* We now have a current line that is shorter than the required width.
   Concatenate with following lines until it exceeds the width, but only if
   there is room for the next word on the line. However, if the end of the
-  paragraph is reached, exit from the function. */
+  paragraph is reached, put the last line in place, delete any lines that are
+  no longer needed, and exit from the function. */
 
-  while (line_charcount(main_current->text, main_current->len) <= width)
+  while (!fmt_wider(width))
     {
-    BOOL ended = parend(nextline, indent, indent2, leftbuf, leftbuflen);
-
-    /* The next line is not part of this paragraph */
-
-    if (ended)
+    if (parend(nextline, indent, indent2, leftbuf, leftbuflen))
       {
+      out = fmt_putline(out, nextline, fmt_buff + fmt_start,
+        fmt_end - fmt_start, key);
+      while (out != nextline) out = line_delete(out, FALSE);
+      if (fmt_size > FORMAT_KEEP)
+        {
+        store_free(fmt_buff);
+        fmt_buff = NULL;
+        }
       main_current = nextline;
       cursor_col = indent;
       return;
@@ -1347,36 +1732,41 @@ for (;;)
 
     /* We try to decide whether it is worth joining the lines. This is an
     optimisation that works in common cases, but not when the second line
-    starts with a space. However, it is fail-safe. */
+    starts with a space. However, it is fail-safe. If an indent or tag exists,
+    it has been checked to be on the next line, so it is not copied. (Indents
+    and tags are always ASCII characters.) */
 
-    if (firstwordlen(nextline) <= spaceleft(main_current, width))
+    if (unformat || firstwordlen(nextline) <= fmt_spaceleft(width))
       {
-      int sp = 0;
-      cmd_recordchanged(main_current, 0);
-
-      /* If an indent or tag exists, it has been checked to be on the next
-      line, so we can remove them. (Indents and tags are always ASCII
-      characters.) */
+      usint skip = 0;
+      usint sp = 0;
 
-      if (minlen > 0) line_deletech(nextline, 0, minlen + indent2, TRUE);
+      if (minlen > 0)
+        {
+        skip = line_offset(nextline, minlen + indent2);
+        if (skip > nextline->len) skip = nextline->len;
+        }
 
-      if (main_current->len > 0 &&
-        main_current->text[main_current->len - 1] != ' ' &&
-          nextline->len > 0 && nextline->text[0] != ' ')
-            sp = 1;
+      if (fmt_end > fmt_start && fmt_buff[fmt_end - 1] != ' ' &&
+          nextline->len > skip && nextline->text[skip] != ' ')
+        sp = 1;
 
-      main_current = line_concat(nextline, sp);
+      fmt_append(sp, nextline->text + skip, nextline->len - skip);
       }
 
     /* Do not join the lines; just move on to the next. */
 
     else
       {
-      main_current = nextline;
+      out = fmt_putline(out, nextline, fmt_buff + fmt_start,
+        fmt_end - fmt_start, key);
+      fmt_start = fmt_end = 0;
+      fmt_append(0, nextline->text, nextline->len);
+      key = nextline->key;
       }
 
-    detrail(main_current);
-    nextline = main_current->next;
+    nextline = nextline->next;
+    fmt_detrail();
     }
   }
 }
@@ -2,10 +2,10 @@
 *       The E text editor - 3rd incarnation      *
 *************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2023 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: January 2023 */
+/* This file last modified: October 2026 */
 
 
 /* This file contains code for matching a search expression. The global
@@ -379,6 +379,7 @@ Returns:     MATCH_OK, MATCH_FAILED or MATCH_ERROR
 int
 cmd_matchse(sestr *se, linestr *line)
 {
+main_stats.se_lines++;
 return matchse(se, line, cmd_casematch? 0 : qsef_U);
 }
 
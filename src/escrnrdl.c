@@ -2,10 +2,10 @@
 *       The E text editor - 3rd incarnation      *
 *************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2023 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: January 2023 */
+/* This file last modified: October 2026 */
 
 
 /* This file contains code for reading a command line off the screen. */
@@ -23,6 +23,21 @@ static int pmax;
 
 
 
+/*************************************************
+*            Show one command character          *
+*************************************************/
+
+/* The command line is shown using one screen cell for each character, so a
+double-width character is shown as the substitution character. */
+
+static void
+showchar(int c)
+{
+s_putc((CHARCELLS(c) > 1)? screen_subchar : c);
+}
+
+
+
 /*************************************************
 *              Reshow altered line               *
 *************************************************/
@@ -56,7 +71,7 @@ if (cp + promptlen < scrolled)
     for (i = 0; bp < be && i + promptlen <= window_width; i++)
       {
       GETCHARINC(k, bp, be);
-      s_putc(k);
+      showchar(k);
       }
     }
   else             /* Not at LHS; scroll left one character */
@@ -69,7 +84,7 @@ if (cp + promptlen < scrolled)
       s_move(0, 0);
       BACKCHAR(bp, cmd_buffer);
       GETCHAR(k, bp, be);
-      s_putc(k);
+      showchar(k);
       }
     }
   }
@@ -83,7 +98,7 @@ else if (changed)
   for (i = cp; bp < be && i + promptlen - scrolled <= window_width; i++)
     {
     GETCHARINC(k, bp, be);
-    s_putc(k);
+    showchar(k);
     }
   if (i + promptlen - scrolled < window_width) s_eraseright();
   }
@@ -102,7 +117,7 @@ if (cp + promptlen + 1 - scrolled > window_width)
       {
       s_move(window_width, 0);
       GETCHARINC(k, bp, be);
-      s_putc(k);
+      showchar(k);
       }
     }
   }
@@ -2,10 +2,10 @@
 *       The E text editor - 3rd incarnation      *
 *************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2023 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: January 2023 */
+/* This file last modified: October 2026 */
 
 /* Store Management Routines. Nowadays the more common term is "memory". This
 elaborate private block management scheme was invented in the days of RISC OS,
@@ -42,6 +42,15 @@ typedef struct {
   size_t block_length;
 } block;
 
+/* The texts of lines are held in blocks that start with a reference count, so
+that several lines (for example, in the cut buffer and in the undo journal) can
+share the same text. The address of a text is that of the byte after the
+count. A shared text must not be altered; see line_unshare(). */
+
+typedef struct {
+  usint text_refs;
+} textblock;
+
 
 
 /*************************************************
@@ -155,6 +164,8 @@ store_freequeuecheck();
 
 /* Keep statistics */
 
+main_stats.store_gets++;
+
 #ifdef TraceStore
 main_storetotal += truebytesize;
 #endif
@@ -210,6 +221,7 @@ while(p != NULL)
     }
   else
     {    /* try next block */
+    main_stats.store_getwalk++;
     previous = p;
     p = p->free_block_next;
     }
@@ -272,16 +284,120 @@ void *
 store_getlbuff(size_t size)
 {
 linestr *line = store_Xget(sizeof(linestr));
-uschar *text = (size == 0)? NULL : store_Xget(size);
+uschar *text = (size == 0)? NULL : store_Xgettext(size);
 line->prev = line->next = NULL;
 line->text = text;
 line->key = line->flags = 0;
+line->undostep = 0;
 line->len = size;
 return line;
 }
 
 
 
+/*************************************************
+*            Get a block for line text           *
+*************************************************/
+
+/* The block starts with a reference count of one.
+
+Argument:  the number of bytes of text
+Returns:   the address for the text, or NULL if no store is available
+*/
+
+uschar *
+store_gettext(size_t size)
+{
+textblock *t = store_get(sizeof(textblock) + size);
+if (t == NULL) return NULL;
+t->text_refs = 1;
+return (uschar *)(t + 1);
+}
+
+
+
+/*************************************************
+*   Get line text store, failing if none         *
+*************************************************/
+
+uschar *
+store_Xgettext(size_t size)
+{
+uschar *yield = store_gettext(size);
+if (yield == NULL) error_moan(1, size);  /* Hard */
+return yield;
+}
+
+
+
+/*************************************************
+*        Share, test, or release line text       *
+*************************************************/
+
+/* These functions accept NULL, which is used for the text of empty lines. */
+
+uschar *
+store_sharetext(uschar *text)
+{
+if (text != NULL) (((textblock *)text) - 1)->text_refs++;
+return text;
+}
+
+BOOL
+store_textshared(uschar *text)
+{
+return text != NULL && (((textblock *)text) - 1)->text_refs > 1;
+}
+
+void
+store_freetext(uschar *text)
+{
+textblock *t;
+if (text == NULL) return;
+t = ((textblock *)text) - 1;
+if (--(t->text_refs) == 0) store_free(t);
+}
+
+
+
+/*************************************************
+*          Find the room in line text            *
+*************************************************/
+
+/* A text block may hold more than the length of its line, both because block
+lengths are rounded up and because a line that is being edited is given room to
+grow, so that characters can be inserted in place.
+
+Argument:  the text, or NULL
+Returns:   the number of bytes the block can hold
+*/
+
+size_t
+store_textsize(uschar *text)
+{
+block *b;
+if (text == NULL) return 0;
+b = ((block *)(((textblock *)text) - 1)) - 1;
+return b->block_length - sizeof(block) - sizeof(textblock);
+}
+
+
+
+/*************************************************
+*          Reduce the length of line text        *
+*************************************************/
+
+/* Shared text is left alone, because the other sharers may need the rest. */
+
+void
+store_choptext(uschar *text, size_t size)
+{
+if (text != NULL && !store_textshared(text))
+  store_chop(((textblock *)text) - 1, sizeof(textblock) + size);
+}
+
+
+
 /*************************************************
 *                 Copy store                     *
 *************************************************/
@@ -304,15 +420,17 @@ if (p == NULL) return NULL; else
 *                 Copy a line                    *
 *************************************************/
 
+/* The text is shared, not copied. */
+
 linestr *
 store_copyline(linestr *line)
 {
-linestr *yield = store_getlbuff(line->len);
-uschar *yieldtext = yield->text;
+linestr *yield = store_Xget(sizeof(linestr));
 memcpy((void *)yield, (void *)line, sizeof(linestr));
 yield->prev = yield->next = NULL;
-yield->text = yieldtext;
-if (line->len > 0) memcpy(yield->text, line->text, line->len);
+yield->text = store_sharetext(line->text);
+yield->undostep = 0;
+yield->flags &= ~(lf_index|lf_layout|lf_rowstart);
 return yield;
 }
 
@@ -376,6 +494,7 @@ while (pdebug != NULL)
 }
 #endif
 
+main_stats.store_frees++;
 previous = store_freequeue;
 this = previous->free_block_next;
 
@@ -397,6 +516,7 @@ debug_printf("Free %5ld %8ld %8p\n", length, main_storetotal, (void *)start);
 while (this != NULL)
   {
   if (start < this) break;
+  main_stats.store_freewalk++;
   previous = this;
   this = previous->free_block_next;
   }
@@ -484,10 +604,11 @@ if (blockrem != 0) bytesize += sizeof(freeblock) - blockrem;
 debug_printf("Chop %5lu %p\n", bytesize, (void *)start);
 #endif
 
-/* Compute amount to free, and don't bother if less than four freeblocks */
+/* Compute amount to free, and don't bother if less than four freeblocks. The
+new length may be more than the old when a caller is leaving room to spare. */
 
+if (start->block_length < bytesize + 4*sizeof(freeblock)) return;
 freelength = start->block_length - bytesize;
-if (freelength < 4*sizeof(freeblock)) return;
 
 /* Set revised length into what remains, create a length for the
 bit to be freed, and free it via the normal function. */
@@ -0,0 +1,279 @@
+/*************************************************
+*       The E text editor - 3rd incarnation      *
+*************************************************/
+
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
+
+/* Written by Philip Hazel, starting November 1991 */
+/* This file last modified: October 2026 */
+
+
+/* This file contains code for writing a trace of an editing session, as
+requested by the -trace command line option. The trace is a file of JSON
+objects, one per line. The first describes the session:
+
+  {"ne":"<version>","term":"<TERM>","rows":<n>,"cols":<n>,"utf8":<bool>,
+    "cwd":"<directory>","argv":[<command line arguments>]}
+
+It is followed by one line for each keystroke in screen mode, and for each
+command line in line-by-line mode:
+
+  {"t":<time>,"key":<code>,"fn":<bool>,"in":"<hex>","exec":<time>,
+    "disp":<time>,"flush":<time>}
+
+  {"t":<time>,"cmd":"<command line>","exec":<time>}
+
+All times are in microseconds; "t" is from the start of the session. The "in"
+field contains the bytes that were read from the terminal, so that a session
+can be replayed exactly by the nereplay program. The time for a keystroke is
+split into the time for obeying it, the time spent in the display functions,
+and the time taken to write the output to the terminal. A keystroke's record is
+therefore not written until NE is about to read the next one.
+
+When no trace is being written, trace_fid is NULL, and the callers check it
+before calling these functions, so that tracing costs nothing otherwise. */
+
+#include "ehdr.h"
+
+#define TRACE_INMAX 32           /* Maximum input bytes recorded per key */
+
+enum { ev_none, ev_key, ev_cmd };
+
+static int     trace_argc;
+static char  **trace_argv;
+static double  trace_start;      /* When the trace was opened */
+static BOOL    trace_header = FALSE;
+
+static int     event = ev_none;  /* Type of open event */
+static double  event_start;      /* When it started */
+static double  phase_start;      /* When the current phase started */
+static double  phase_time[trace_phases];
+static int     phase = trace_execute;
+static int     event_key;
+static BOOL    event_fn;
+static uschar *event_cmd;
+
+static uschar  inbuff[TRACE_INMAX];
+static int     inlen = 0;
+
+
+
+/*************************************************
+*               Read the clock                   *
+*************************************************/
+
+static double
+now(void)
+{
+struct timespec ts;
+clock_gettime(CLOCK_MONOTONIC, &ts);
+return ts.tv_sec*1e6 + ts.tv_nsec/1e3;
+}
+
+
+
+/*************************************************
+*           Write a JSON string                  *
+*************************************************/
+
+/* Quotes, backslashes, and control characters are escaped. Other bytes are
+written as they are.
+
+Argument:  the string, zero-terminated
+Returns:   nothing
+*/
+
+static void
+putstring(const uschar *s)
+{
+fputc('"', trace_fid);
+for (; *s != 0; s++)
+  {
+  if (*s == '"' || *s == '\\') fprintf(trace_fid, "\\%c", *s);
+  else if (*s < 32 || *s == 127) fprintf(trace_fid, "\\u%04x", *s);
+  else fputc(*s, trace_fid);
+  }
+fputc('"', trace_fid);
+}
+
+
+
+/*************************************************
+*              Start a trace                     *
+*************************************************/
+
+/* Called while decoding the command line. The header is not written until the
+first event, because the screen size is not known until then.
+
+Arguments:
+  name       the file name
+  argc       the command line argument count
+  argv       the command line arguments
+
+Returns:     nothing; a failure to open the file is a hard error
+*/
+
+void
+trace_open(uschar *name, int argc, char **argv)
+{
+trace_fid = sys_fopen(name, US"w");
+if (trace_fid == NULL)
+  error_moan(5, name, "writing", strerror(errno));  /* Hard */
+trace_argc = argc;
+trace_argv = argv;
+trace_start = now();
+}
+
+
+
+/*************************************************
+*             Write the header                   *
+*************************************************/
+
+static void
+writeheader(void)
+{
+uschar cwd[FNAME_BUFFER_SIZE];
+const char *term = getenv("TERM");
+
+fprintf(trace_fid, "{\"ne\":");
+putstring(version_string);
+fprintf(trace_fid, ",\"term\":");
+putstring(US((term == NULL)? "" : term));
+fprintf(trace_fid, ",\"rows\":%d,\"cols\":%d,\"utf8\":%s,\"cwd\":",
+  main_screenOK? screen_max_row + 1 : 0, main_screenOK? screen_max_col + 1 : 0,
+  main_utf8terminal? "true" : "false");
+putstring((getcwd(CS cwd, sizeof(cwd)) == NULL)? US"" : cwd);
+fprintf(trace_fid, ",\"argv\":[");
+for (int i = 0; i < trace_argc; i++)
+  {
+  if (i > 0) fputc(',', trace_fid);
+  putstring(US trace_argv[i]);
+  }
+fprintf(trace_fid, "]}\n");
+trace_header = TRUE;
+}
+
+
+
+/*************************************************
+*             Record input bytes                 *
+*************************************************/
+
+/* This is called for each byte read from the terminal, before the keystroke
+it belongs to is known. */
+
+void
+trace_input(int c)
+{
+if (inlen < TRACE_INMAX) inbuff[inlen++] = c;
+}
+
+
+
+/*************************************************
+*               Start an event                   *
+*************************************************/
+
+static void
+begin(int type)
+{
+if (!trace_header) writeheader();
+trace_end();
+event = type;
+event_start = phase_start = now();
+for (int i = 0; i < trace_phases; i++) phase_time[i] = 0.0;
+phase = trace_execute;
+}
+
+/* A keystroke has been read. */
+
+void
+trace_key(int type, int key)
+{
+begin(ev_key);
+event_key = key;
+event_fn = type == ktype_function;
+}
+
+/* A command line is about to be obeyed. */
+
+void
+trace_command(uschar *cmdline)
+{
+begin(ev_cmd);
+event_cmd = store_copystring(cmdline);
+}
+
+
+
+/*************************************************
+*            Change the current phase            *
+*************************************************/
+
+/* The time since the last change is added to the phase that is ending. If no
+event is in progress, nothing is timed.
+
+Argument:  the new phase
+Returns:   the previous phase, for restoring
+*/
+
+int
+trace_phase(int newphase)
+{
+int yield = phase;
+if (event != ev_none && newphase != phase)
+  {
+  double t = now();
+  phase_time[phase] += t - phase_start;
+  phase_start = t;
+  }
+phase = newphase;
+return yield;
+}
+
+
+
+/*************************************************
+*               End an event                     *
+*************************************************/
+
+/* The record is written and flushed, so that a trace is complete even if NE
+is killed.
+
+Arguments:  none
+Returns:    nothing
+*/
+
+void
+trace_end(void)
+{
+if (event == ev_none) return;
+phase_time[phase] += now() - phase_start;
+
+fprintf(trace_fid, "{\"t\":%.0f,", event_start - trace_start);
+if (event == ev_key)
+  {
+  fprintf(trace_fid, "\"key\":%d,\"fn\":%s,\"in\":\"", event_key,
+    event_fn? "true" : "false");
+  for (int i = 0; i < inlen; i++) fprintf(trace_fid, "%02x", inbuff[i]);
+  fprintf(trace_fid, "\",\"exec\":%.0f,\"disp\":%.0f,\"flush\":%.0f}\n",
+    phase_time[trace_execute], phase_time[trace_display],
+    phase_time[trace_flush]);
+  inlen = 0;
+  }
+else
+  {
+  fprintf(trace_fid, "\"cmd\":");
+  putstring(event_cmd);
+  fprintf(trace_fid, ",\"exec\":%.0f}\n", phase_time[trace_execute] +
+    phase_time[trace_display] + phase_time[trace_flush]);
+  store_free(event_cmd);
+  }
+
+fflush(trace_fid);
+event = ev_none;
+phase = trace_execute;
+}
+
+/* End of etrace.c */
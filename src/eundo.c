@@ -0,0 +1,740 @@
+/*************************************************
+*       The E text editor - 3rd incarnation      *
+*************************************************/
+
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
+
+/* Written by Philip Hazel, starting November 1991 */
+/* This file last modified: October 2026 */
+
+
+/* This file contains code for maintaining the undo journal and for the UNDO
+and REDO operations.
+
+Each buffer has its own journal, which is a list of "steps", newest first. A
+step contains the changes made by one command line or one keystroke, except
+that consecutive data keystrokes on the same line are coalesced. The changes
+are recorded as a list of records, also newest first, of three kinds:
+
+  ur_text    The previous text of a line that has been changed. Only the first
+             change to a line in any one step is recorded, so a GE that alters
+             many lines saves each one once. The text itself is shared with
+             the line rather than copied.
+
+  ur_insert  A block of lines that was inserted. Nothing is copied; undoing
+             just unlinks the block.
+
+  ur_remove  A block of lines that was removed. The lines themselves are kept,
+             so undoing just links them back in.
+
+Undoing a step applies its records in reverse order. Each record is changed
+into its own inverse as it is applied (text is swapped, an insertion becomes a
+removal and vice versa) and the step is moved to the redo list, from which it
+can be re-applied in the same way. Because records refer to line blocks by
+address, every change to a buffer's lines must be recorded for as long as its
+journal is active. When a step is recorded for a buffer, its redo list is
+discarded.
+
+The total memory held by each buffer's undo list is limited by main_undolimit.
+The oldest steps are discarded when it is exceeded. If the current step on its
+own exceeds the limit, the whole journal is discarded and nothing more is
+recorded until the next step begins. */
+
+#include "ehdr.h"
+
+
+/* The number of lines in a block that is unlinked by undoing, up to which its
+lines are checked for being marked or in the back list. Larger blocks cancel
+the marks and empty the back list, so as to keep undoing a large insertion
+cheap. */
+
+#define undo_scanlimit  1000
+
+static usint      stepno = 1;          /* Current step number */
+static usint      loststep = 0;        /* Step for which recording failed */
+static BOOL       lasttyping = FALSE;  /* Previous step was typing */
+static linestr   *typingline = NULL;   /* Line on which typing happened */
+static bufferstr *beginbuffer = NULL;  /* Buffer when current step began */
+static linestr   *beginline = NULL;    /* Cursor line when step began */
+static int        begincol = 0;        /* Cursor column when step began */
+
+
+
+/*************************************************
+*            Start a new undo step               *
+*************************************************/
+
+/* This is called at the start of each command line and each keystroke. The
+step number is advanced unless this is a data keystroke that follows another
+on the same line.
+
+Argument:  TRUE for a data keystroke
+Returns:   nothing
+*/
+
+void
+undo_begin(BOOL typing)
+{
+if (!typing || !lasttyping || beginbuffer != currentbuffer ||
+    typingline != main_current)
+  {
+  if (++stepno == 0) stepno = 1;    /* Zero is never a step number */
+  beginbuffer = currentbuffer;
+  beginline = main_current;
+  begincol = cursor_col;
+  }
+lasttyping = typing;
+typingline = main_current;
+}
+
+
+
+/*************************************************
+*        Test whether changes are recorded       *
+*************************************************/
+
+/* Callers that would otherwise give away or free lines use this to decide
+whether to hand them to undo_removed() instead.
+
+Arguments:  none
+Returns:    TRUE if changes to the current buffer are being recorded
+*/
+
+BOOL
+undo_active(void)
+{
+return main_undolimit > 0 && !undo_suspended && loststep != stepno &&
+  currentbuffer != NULL;
+}
+
+
+
+/*************************************************
+*        Test whether a removal can be kept      *
+*************************************************/
+
+/* This is called before a large block of lines is handed to undo_removed(), so
+that the block need not be copied when it is bound to overflow the journal.
+The test is the one that account() would apply; if it fails, the journal is
+discarded in the same way.
+
+Argument:  the memory size of the block
+Returns:   TRUE if the block can be recorded
+*/
+
+BOOL
+undo_fits(size_t size)
+{
+bufferstr *b = currentbuffer;
+undostep *step = b->undo;
+
+size += sizeof(undorec) + sizeof(undostep);
+if (step != NULL && step->stepno == stepno) size += step->size;
+if (size <= main_undolimit) return TRUE;
+
+undo_discard(b);
+loststep = stepno;
+error_moan(77);
+return FALSE;
+}
+
+
+
+/*************************************************
+*         Free the lines in a block              *
+*************************************************/
+
+/* This is used when a removal record is discarded. In screen mode, ensure
+that the table of displayed lines does not contain any freed line; see the
+comment in line_delete().
+
+Arguments:
+  line       the first line
+  count      the number of lines
+
+Returns:     nothing
+*/
+
+static void
+freelines(linestr *line, int count)
+{
+while (count-- > 0)
+  {
+  linestr *next = line->next;
+  if (main_screenOK)
+    {
+    for (usint i = 0; i <= window_depth; i++)
+      if (window_vector[i] == line) window_vector[i] = (linestr *)(+1);
+    }
+  store_freetext(line->text);
+  store_free(line);
+  line = next;
+  }
+}
+
+
+
+/*************************************************
+*           Free a chain of steps                *
+*************************************************/
+
+/*
+Arguments:
+  step       the first step
+  lines      TRUE to free lines held by removal records
+
+Returns:     nothing
+*/
+
+static void
+freesteps(undostep *step, BOOL lines)
+{
+while (step != NULL)
+  {
+  undostep *nextstep = step->next;
+  undorec *r = step->records;
+  while (r != NULL)
+    {
+    undorec *next = r->next;
+    if (r->type == ur_text) store_freetext(r->text);
+      else if (r->type == ur_remove && lines) freelines(r->first, r->count);
+    store_free(r);
+    r = next;
+    }
+  store_free(step);
+  step = nextstep;
+  }
+}
+
+
+
+/*************************************************
+*          Discard a buffer's journal            *
+*************************************************/
+
+/* This is called when a buffer is emptied or when recording is turned off, as
+well as when the journal overflows.
+
+Argument:  the buffer
+Returns:   nothing
+*/
+
+void
+undo_discard(bufferstr *buffer)
+{
+freesteps(buffer->undo, TRUE);
+freesteps(buffer->redo, TRUE);
+buffer->undo = buffer->undo_oldest = buffer->redo = NULL;
+buffer->undosize = 0;
+}
+
+
+
+/*************************************************
+*            Memory held by a record             *
+*************************************************/
+
+static size_t
+recsize(undorec *r)
+{
+return sizeof(undorec) + ((r->type == ur_insert)? 0 : r->size);
+}
+
+
+
+/*************************************************
+*           Add a record to the journal          *
+*************************************************/
+
+/* A new step is started if the current buffer's newest step is not the current
+one. Its starting cursor position is the one saved by undo_begin() if the
+buffer has not changed since then; otherwise the given line is used. It must be
+a line that was in the buffer before the change that is being recorded.
+
+Arguments:
+  type       the record type
+  where      a line for the starting position of a new step
+
+Returns:     the new record, with its type and chain set
+*/
+
+static undorec *
+addrecord(int type, linestr *where)
+{
+bufferstr *b = currentbuffer;
+undostep *step = b->undo;
+undorec *r;
+
+if (step == NULL || step->stepno != stepno)
+  {
+  freesteps(b->redo, TRUE);
+  b->redo = NULL;
+
+  step = store_Xget(sizeof(undostep));
+  step->stepno = stepno;
+  step->records = NULL;
+  step->size = sizeof(undostep);
+  step->afterline = NULL;
+  step->aftercol = 0;
+
+  if (beginbuffer == b)
+    {
+    step->line = beginline;
+    step->col = begincol;
+    }
+  else
+    {
+    step->line = where;
+    step->col = 0;
+    }
+
+  step->prev = NULL;
+  step->next = b->undo;
+  if (b->undo == NULL) b->undo_oldest = step; else b->undo->prev = step;
+  b->undo = step;
+  b->undosize += step->size;
+  }
+
+r = store_Xget(sizeof(undorec));
+r->type = type;
+r->next = step->records;
+step->records = r;
+return r;
+}
+
+
+
+/*************************************************
+*        Account for memory and apply limit      *
+*************************************************/
+
+/* This is called when memory has been added to the newest step of the current
+buffer. Old steps are discarded as necessary to keep within the limit.
+
+Argument:  the number of bytes added
+Returns:   nothing
+*/
+
+static void
+account(size_t size)
+{
+bufferstr *b = currentbuffer;
+
+b->undo->size += size;
+b->undosize += size;
+
+while (b->undosize > main_undolimit)
+  {
+  undostep *old = b->undo_oldest;
+  if (old == b->undo)
+    {
+    undo_discard(b);
+    loststep = stepno;
+    error_moan(77);
+    return;
+    }
+  b->undo_oldest = old->prev;
+  old->prev->next = NULL;
+  b->undosize -= old->size;
+  freesteps(old, TRUE);
+  }
+}
+
+
+
+/*************************************************
+*          Size of a block of lines              *
+*************************************************/
+
+static size_t
+blocksize(linestr *first, int count)
+{
+size_t size = 0;
+while (count-- > 0)
+  {
+  size += sizeof(linestr) + first->len;
+  first = first->next;
+  }
+return size;
+}
+
+
+
+/*************************************************
+*          Record a change to a line             *
+*************************************************/
+
+/* This must be called before a line in the current buffer is altered in any
+way. The text is saved only the first time in any step. It is shared with the
+line, so a change that alters the text in place has to unshare it first. The
+crash-recovery journal is told about every change, whether or not undo
+information is being kept.
+
+Argument:  the line that is about to be changed
+Returns:   nothing
+*/
+
+void
+undo_text(linestr *line)
+{
+undorec *r;
+
+line->flags &= ~lf_chbits;
+journal_text(line);
+if (line->undostep == stepno || !undo_active()) return;
+line->undostep = stepno;
+
+r = addrecord(ur_text, line);
+r->first = line;
+r->len = line->len;
+r->key = line->key;
+r->flags = line->flags;
+r->size = line->len;
+r->text = store_sharetext(line->text);
+account(recsize(r));
+}
+
+
+
+/*************************************************
+*        Record insertion of lines               *
+*************************************************/
+
+/* This is called after a block of lines has been linked into the current
+buffer. The crash-recovery journal is told about it.
+
+Arguments:
+  first      the first inserted line
+  last       the last inserted line
+  count      the number of lines
+
+Returns:     nothing
+*/
+
+void
+undo_inserted(linestr *first, linestr *last, int count)
+{
+undorec *r;
+journal_inserted(first, last, count);
+if (!undo_active()) return;
+r = addrecord(ur_insert, (last->next != NULL)? last->next : first->prev);
+r->first = first;
+r->last = last;
+r->count = count;
+r->size = blocksize(first, count);
+account(recsize(r));
+}
+
+
+
+/*************************************************
+*         Record removal of lines                *
+*************************************************/
+
+/* This is called, only when undo_active() is TRUE, after a block of lines has
+been unlinked from the current buffer. The block must still be chained
+internally. The journal takes over the lines. Removal of the block that follows
+the one removed by the previous record is merged into that record. The
+crash-recovery journal is told about removals separately, by the callers.
+
+Arguments:
+  first      the first removed line
+  last       the last removed line
+  count      the number of lines
+  prev       the line that preceded the block, or NULL
+  after      the line that followed the block, or NULL
+
+Returns:     nothing
+*/
+
+void
+undo_removed(linestr *first, linestr *last, int count, linestr *prev,
+  linestr *after)
+{
+undostep *step = currentbuffer->undo;
+undorec *r;
+size_t size = blocksize(first, count);
+
+if (step != NULL && step->stepno == stepno && step->records != NULL)
+  {
+  r = step->records;
+  if (r->type == ur_remove && r->prev == prev && r->after == first)
+    {
+    r->last->next = first;
+    first->prev = r->last;
+    r->last = last;
+    r->after = after;
+    r->count += count;
+    r->size += size;
+    account(size);
+    return;
+    }
+  }
+
+r = addrecord(ur_remove, (after != NULL)? after : prev);
+r->first = first;
+r->last = last;
+r->count = count;
+r->prev = prev;
+r->after = after;
+r->size = size;
+account(recsize(r));
+}
+
+
+
+/*************************************************
+*        Detach lines that are being unlinked    *
+*************************************************/
+
+/* When undoing unlinks a block of lines, any marks or back list entries that
+refer to them must be removed. For a large block it is cheaper to cancel the
+marks and empty the back list.
+
+Arguments:
+  line       the first line of the block
+  count      the number of lines
+
+Returns:     nothing
+*/
+
+static void
+detach(linestr *line, int count)
+{
+if (count > undo_scanlimit)
+  {
+  mark_type = mark_unset;
+  mark_line = mark_line_global = NULL;
+  main_backlist[0].line = NULL;
+  main_backtop = main_backnext = 0;
+  return;
+  }
+
+while (count-- > 0)
+  {
+  if (mark_line == line)
+    {
+    mark_type = mark_unset;
+    mark_line = NULL;
+    }
+  if (mark_line_global == line) mark_line_global = NULL;
+
+  for (usint i = 0; i <= main_backtop; i++)
+    {
+    if (main_backlist[i].line == line)
+      {
+      if (main_backtop == 0)
+        {
+        main_backlist[0].line = NULL;
+        }
+      else
+        {
+        memmove(main_backlist + i, main_backlist + i + 1,
+          (main_backtop - i) * sizeof(backstr));
+        if (main_backnext == main_backtop) main_backnext--;
+        main_backtop--;
+        }
+      break;
+      }
+    }
+
+  line = line->next;
+  }
+}
+
+
+
+/*************************************************
+*       Apply a step's records in reverse        *
+*************************************************/
+
+/* Each record is inverted as it is applied, and the list of records is
+reversed, so that applying it again restores the original state. Before any
+structural change is made, the neighbouring lines are checked for consistency
+with the record. The step's size is recomputed.
+
+Argument:  the step
+Returns:   TRUE if all went well; FALSE if an inconsistency was found
+*/
+
+static BOOL
+applystep(undostep *step)
+{
+undorec *r = step->records;
+undorec *done = NULL;
+
+step->size = sizeof(undostep);
+
+while (r != NULL)
+  {
+  undorec *next = r->next;
+  linestr *line = r->first;
+
+  switch (r->type)
+    {
+    case ur_text:
+      {
+      uschar *text = line->text;
+      usint len = line->len;
+      int key = line->key;
+      usint flags = line->flags;
+
+      journal_text(line);
+      line->text = r->text;
+      line->len = r->len;
+      line->key = r->key;
+      line->flags = (r->flags & ~(lf_index|lf_layout|lf_rowstart)) |
+        lf_shn | lf_clend;
+
+      r->text = text;
+      r->len = len;
+      r->key = key;
+      r->flags = flags & ~lf_shbits;
+      r->size = len;
+      }
+    break;
+
+    case ur_insert:
+      {
+      linestr *prev = line->prev;
+      linestr *after = r->last->next;
+
+      if ((prev == NULL)? main_top != line : prev->next != line) return FALSE;
+      if ((after == NULL)? main_bottom != r->last : after->prev != r->last)
+        return FALSE;
+
+      if (prev == NULL) main_top = after; else prev->next = after;
+      if (after == NULL) main_bottom = prev; else after->prev = prev;
+      main_linecount -= r->count;
+      detach(line, r->count);
+      journal_removed(line, r->count, prev);
+
+      r->prev = prev;
+      r->after = after;
+      r->type = ur_remove;
+      }
+    break;
+
+    case ur_remove:
+      {
+      linestr *prev = r->prev;
+      linestr *after = r->after;
+
+      if ((prev == NULL)? main_top != after : prev->next != after) return FALSE;
+      if ((after == NULL)? main_bottom != prev : after->prev != prev)
+        return FALSE;
+
+      line->prev = prev;
+      r->last->next = after;
+      if (prev == NULL) main_top = line; else prev->next = line;
+      if (after == NULL) main_bottom = r->last; else after->prev = r->last;
+      main_linecount += r->count;
+      journal_inserted(line, r->last, r->count);
+
+      r->type = ur_insert;
+      }
+    break;
+    }
+
+  step->size += recsize(r);
+  r->next = done;
+  done = r;
+  step->records = r = next;
+  }
+
+step->records = done;
+return TRUE;
+}
+
+
+
+/*************************************************
+*        Handle an inconsistent journal          *
+*************************************************/
+
+/* This should never happen. It means that some change was not recorded. The
+journal is discarded without freeing any lines, because some of them may be
+back in the buffer.
+
+Argument:  the step that was being applied
+Returns:   nothing
+*/
+
+static void
+inconsistent(undostep *step)
+{
+/* LCOV_EXCL_START */
+bufferstr *b = currentbuffer;
+step->next = b->undo;
+b->undo = step;
+freesteps(b->undo, FALSE);
+freesteps(b->redo, FALSE);
+b->undo = b->undo_oldest = b->redo = NULL;
+b->undosize = 0;
+error_moan(78);
+/* LCOV_EXCL_STOP */
+}
+
+
+
+/*************************************************
+*            Undo or redo a step                 *
+*************************************************/
+
+/* UNDO takes the newest step from the undo list, applies it, and puts it on
+the redo list; REDO does the opposite. The cursor is put back where it was
+before or after the step, respectively. A new step is started afterwards, so
+that subsequent changes are recorded separately.
+
+Argument:  TRUE for UNDO, FALSE for REDO
+Returns:   TRUE if there was something to undo or redo
+*/
+
+BOOL
+undo_undoredo(BOOL undo)
+{
+bufferstr *b = currentbuffer;
+undostep *step = undo? b->undo : b->redo;
+
+if (step == NULL) return FALSE;
+
+if (undo)
+  {
+  b->undo = step->next;
+  if (b->undo == NULL) b->undo_oldest = NULL; else b->undo->prev = NULL;
+  b->undosize -= step->size;
+  step->afterline = main_current;
+  step->aftercol = cursor_col;
+  }
+else b->redo = step->next;
+
+if (!applystep(step))
+  {
+  inconsistent(step);    /* LCOV_EXCL_LINE */
+  return TRUE;           /* LCOV_EXCL_LINE */
+  }
+
+if (undo)
+  {
+  step->next = b->redo;
+  b->redo = step;
+  main_current = step->line;
+  cursor_col = step->col;
+  }
+else
+  {
+  step->prev = NULL;
+  step->next = b->undo;
+  if (b->undo == NULL) b->undo_oldest = step; else b->undo->prev = step;
+  b->undo = step;
+  b->undosize += step->size;
+  main_current = step->afterline;
+  cursor_col = step->aftercol;
+  }
+
+main_filechanged = TRUE;
+undo_begin(FALSE);
+return TRUE;
+}
+
+/* End of eundo.c */
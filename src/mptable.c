@@ -2,28 +2,50 @@
 *       The E text editor - 3rd incarnation      *
 *************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2023 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: January 2023 */
-
-/* This file is not part of NE itself. It is an auxiliary program that tests
-UTF-8 characters for screen displayability. It creates the source of
-chdisplay.c, which contains a bit table for those that are. Characters with
-code points in the range U+0100 to U+FFFF are tested; those with lesser code
-points are assumed.
-
-The program works only in an xterm that has UTF-8 enabled, by reading the
-cursor position, outputting a candidate character in UTF-8, re-reading the
-cursor position, and determining whether the character has displayed something
-using precisely one character box. */
+/* This file last modified: October 2026 */
+
+/* This file is not part of NE itself. It is an auxiliary program that finds
+the screen width of every Unicode character. It creates the source of
+chdisplay.c, which contains a multi-stage table of widths and the ch_width()
+function that looks them up. The width of a character is the number of
+character boxes it uses when output on its own: 1 or 2 for those that NE can
+display as they are, and 0 for those that it cannot (control characters,
+combining characters, and code points that are not assigned or that the
+terminal does not handle). Characters with code points in the range U+0100 to
+U+10FFFF are tested; those with lesser code points are assumed.
+
+By default, the program works only in an xterm that has UTF-8 enabled, by
+reading the cursor position, outputting a candidate character in UTF-8,
+re-reading the cursor position, and seeing how far the cursor has moved. This
+takes some time for all the planes. If the -wcwidth option is given, the C
+library's wcwidth() function in a UTF-8 locale is used instead, and no terminal
+is needed.
+
+The table has three stages. The width of each character is held in two bits,
+so each group of 256 consecutive characters uses a 64-byte block. Identical
+blocks are stored only once, and there are few different ones, because so many
+groups are entirely one width, or entirely unassigned. Each plane of 65536
+characters has a row of 256 block numbers, and identical rows are also stored
+once, so the first stage is just a row number for each of the 17 planes. */
+
+#define _XOPEN_SOURCE 700
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <fcntl.h>
+#include <locale.h>
 #include <termio.h>
 #include <unistd.h>
+#include <wchar.h>
+
+#define MAXCHAR    0x10ffff
+#define BLOCKSIZE  64            /* bytes in a block of 256 widths */
+#define MAXBLOCKS  256           /* block numbers are bytes */
+#define PLANES     17
 
 static const int utf8_table1[] = {
   0x0000007f, 0x000007ff, 0x0000ffff, 0x001fffff, 0x03ffffff, 0x7fffffff};
@@ -33,6 +55,13 @@ static const int utf8_table2[] = {
 
 static int ioctl_fd;
 
+static unsigned char widths[MAXCHAR + 1];
+static unsigned char blocks[MAXBLOCKS][BLOCKSIZE];
+static unsigned char rows[PLANES][256];
+static unsigned char planes[PLANES];
+static int blockcount = 0;
+static int rowcount = 0;
+
 
 static int
 ord2utf8(int cvalue, unsigned char *buffer)
@@ -80,12 +109,24 @@ for (;;)
 }
 
 
+/* Find the width of a character by outputting it, or from wcwidth(). Only 1
+and 2 count as widths; anything else is treated as "not displayable". */
+
 static int
-is_printable(int c)
+measure(int c, int use_wcwidth)
 {
 unsigned char buff[8];
-int len = ord2utf8(c, buff);
-int i, rowa, rowb, cola, colb;
+int len, rowa, rowb, cola, colb;
+
+if (c >= 0xd800 && c <= 0xdfff) return 0;    /* Surrogates */
+
+if (use_wcwidth)
+  {
+  int w = wcwidth((wchar_t)c);
+  return (w == 1 || w == 2)? w : 0;
+  }
+
+len = ord2utf8(c, buff);
 if (len <= 0)
   {
   printf("**** UTF-8 error %d for U+%0x\n", len, c);
@@ -95,94 +136,185 @@ read_position(&rowb, &colb);
 if (write(ioctl_fd, buff, len));
 read_position(&rowa, &cola);
 if (write(ioctl_fd, "\r", 1));
-return rowa == rowb && cola - colb == 1;
+if (rowa != rowb) return 0;
+return (cola - colb == 1 || cola - colb == 2)? cola - colb : 0;
 }
 
 
+/* List the ranges of characters of a given width in the comment. */
+
 static void
-setrange(unsigned char *p, int start, int end, int *pcount)
+listranges(int width)
 {
-if (*pcount >= 7)
+int count = 0;
+int start = -1;
+
+for (int c = 0; c <= MAXCHAR + 1; c++)
   {
-  printf("%04x-%04x\n", start, end);
-  *pcount = 0;
+  if (c <= MAXCHAR && widths[c] == width)
+    {
+    if (start < 0) start = c;
+    continue;
+    }
+  if (start < 0) continue;
+  printf("%04x-%04x%s", start, c - 1, (++count % 6 == 0)? "\n" : " ");
+  start = -1;
   }
-else
+if (count % 6 != 0) printf("\n");
+}
+
+
+/* Find or add a block of widths, returning its number. */
+
+static int
+findblock(int base)
+{
+unsigned char block[BLOCKSIZE];
+int i;
+
+memset(block, 0, BLOCKSIZE);
+for (i = 0; i < 256; i++)
+  block[i/4] |= widths[base + i] << ((i%4)*2);
+
+for (i = 0; i < blockcount; i++)
+  if (memcmp(blocks[i], block, BLOCKSIZE) == 0) return i;
+
+if (blockcount >= MAXBLOCKS)
   {
-  printf("%04x-%04x ", start, end);
-  *pcount += 1;
+  printf("**** More than %d different blocks\n", MAXBLOCKS);
+  exit(1);
   }
-
-for (; start <= end; start++) p[start/8] |= (1 << (start%8));
+memcpy(blocks[blockcount], block, BLOCKSIZE);
+return blockcount++;
 }
 
 
 int
-main(void)
+main(int argc, char **argv)
 {
 struct termios oldparm, newparm;
-unsigned char *p = malloc(8192);
-int startrange = -1;
-int count = 0;
+int use_wcwidth = argc > 1 && strcmp(argv[1], "-wcwidth") == 0;
 int c;
 
-printf("/*************************************************\n"
-       "*       The E text editor - 3rd incarnation      *\n"
-       "*************************************************/\n\n"
+/* Characters up to U+00FF are not tested. */
 
-       "/* Copyright (c) University of Cambridge, 1991 - 2023 */\n"
-       "/* Written by Philip Hazel, starting November 1991 */\n\n"
+for (c = 0; c < 0x100; c++)
+  widths[c] = (c < 0x20 || (c >= 0x7f && c <= 0x9f))? 0 : 1;
 
-       "/* This file is generated by the mptable program. It defines a table\n"
-       "of bits that identifies which Unicode characters in the range 0 to\n"
-       "0xffff are displayable. A one bit means 'not displayable'. These are\n"
-       "the non-displayable ranges:\n\n");
-
-memset((char *)p, 0, 8192);
-setrange(p, 0, 0x1f, &count);
-setrange(p, 0x7f, 0x9f, &count);
-
-ioctl_fd = open("/dev/tty", O_RDWR);
-tcgetattr(ioctl_fd, &oldparm);
-newparm = oldparm;
-newparm.c_iflag &= ~(IGNCR | ICRNL);
-newparm.c_lflag &= ~(ICANON | ECHO | ISIG);
-newparm.c_cc[VMIN] = 1;
-newparm.c_cc[VTIME] = 0;
-newparm.c_cc[VSTART] = 0;
-newparm.c_cc[VSTOP] = 0;
+if (use_wcwidth)
+  {
+  if (setlocale(LC_CTYPE, "C.UTF-8") == NULL &&
+      setlocale(LC_CTYPE, "en_US.UTF-8") == NULL)
+    {
+    printf("**** No UTF-8 locale is available\n");
+    return 1;
+    }
+  }
+else
+  {
+  ioctl_fd = open("/dev/tty", O_RDWR);
+  tcgetattr(ioctl_fd, &oldparm);
+  newparm = oldparm;
+  newparm.c_iflag &= ~(IGNCR | ICRNL);
+  newparm.c_lflag &= ~(ICANON | ECHO | ISIG);
+  newparm.c_cc[VMIN] = 1;
+  newparm.c_cc[VTIME] = 0;
+  newparm.c_cc[VSTART] = 0;
+  newparm.c_cc[VSTOP] = 0;
 #ifndef NO_VDISCARD
-newparm.c_cc[VDISCARD] = 0;
+  newparm.c_cc[VDISCARD] = 0;
 #endif
-tcsetattr(ioctl_fd, TCSANOW, &newparm);
+  tcsetattr(ioctl_fd, TCSANOW, &newparm);
+  }
+
+for (c = 0x100; c <= MAXCHAR; c++) widths[c] = measure(c, use_wcwidth);
 
-for (c = 0x100; c < 0xffff; c++)
+if (!use_wcwidth)
   {
-  if (is_printable(c))
-    {
-    if (startrange < 0) continue;
-    setrange(p, startrange, c - 1, &count);
-    startrange = -1;
-    }
-  else
-    {
-    if (startrange < 0) startrange = c;
-    }
+  tcsetattr(ioctl_fd, TCSANOW, &oldparm);
+  close(ioctl_fd);
   }
 
-if (startrange >= 0) setrange(p, startrange, c - 1, &count);
+/* Build the blocks and rows, sharing identical ones. */
 
-tcsetattr(ioctl_fd, TCSANOW, &oldparm);
-close(ioctl_fd);
+for (int p = 0; p < PLANES; p++)
+  {
+  int r;
+  unsigned char row[256];
+  for (int i = 0; i < 256; i++) row[i] = findblock((p << 16) + (i << 8));
+  for (r = 0; r < rowcount; r++)
+    if (memcmp(rows[r], row, 256) == 0) break;
+  if (r == rowcount) memcpy(rows[rowcount++], row, 256);
+  planes[p] = r;
+  }
+
+printf("/*************************************************\n"
+       "*       The E text editor - 3rd incarnation      *\n"
+       "*************************************************/\n\n"
+
+       "/* Copyright (c) University of Cambridge, 1991 - 2026 */\n"
+       "/* Written by Philip Hazel, starting November 1991 */\n\n"
+
+       "/* This file is generated by the mptable program%s. It defines\n"
+       "a three-stage table of the screen widths of Unicode characters, and\n"
+       "the function that looks them up. A width of 0 means 'not displayable';\n"
+       "these are control characters, combining characters, and unassigned\n"
+       "code points. These are the ranges of characters of width 2:\n\n",
+       use_wcwidth? ", using wcwidth()" : "");
+
+listranges(2);
+
+printf("\nThere are %d different blocks and %d different rows. */\n\n"
+       "#include \"ehdr.h\"\n\n", blockcount, rowcount);
+
+printf("/* Row number for each plane */\n\n"
+       "static const uschar ch_width_planes[] = {");
+for (int p = 0; p < PLANES; p++)
+  printf("%s%d", (p == 0)? "\n  " : ",", planes[p]);
+printf(" };\n\n");
+
+printf("/* Block number for each 256 characters in a plane */\n\n"
+       "static const uschar ch_width_rows[][256] = {\n");
+for (int r = 0; r < rowcount; r++)
+  {
+  printf("  {");
+  for (int i = 0; i < 256; i++)
+    printf("%s%3d", (i == 0)? "" : (i%16 == 0)? ",\n   " : ",", rows[r][i]);
+  printf(" }%s\n", (r == rowcount - 1)? "" : ",");
+  }
+printf("};\n\n");
 
-printf("*/\n\n#include \"ehdr.h\"\n\n"
-       "uschar ch_displayable[] = {\n  0x%02x,", p[0]);
-for (c = 1; c < 8191; c++)
+printf("/* Two bits of width for each of 256 characters */\n\n"
+       "static const uschar ch_width_blocks[][64] = {\n");
+for (int b = 0; b < blockcount; b++)
   {
-  if (c%8 == 0) printf("  /* %04x */\n  ", (c - 8)*8);
-  printf("0x%02x,", p[c]);
+  printf("  {");
+  for (int i = 0; i < BLOCKSIZE; i++)
+    printf("%s0x%02x", (i == 0)? "" : (i%16 == 0)? ",\n   " : ",",
+      blocks[b][i]);
+  printf(" }%s  /* %d */\n", (b == blockcount - 1)? "" : ",", b);
   }
-printf("0x%02x}; /* ffc0 */\n", p[8191]);
+printf("};\n\n");
+
+printf("\n\n"
+  "/*************************************************\n"
+  "*        Find screen width of a character        *\n"
+  "*************************************************/\n\n"
+
+  "/* Argument:  a character code point\n"
+  "   Returns:   0 if the character is not displayable, 1 or 2 otherwise\n"
+  "*/\n\n"
+
+  "usint\n"
+  "ch_width(usint c)\n"
+  "{\n"
+  "usint b;\n"
+  "if (c > 0x10ffff) return 0;\n"
+  "b = ch_width_rows[ch_width_planes[c >> 16]][(c >> 8) & 0xff];\n"
+  "return (ch_width_blocks[b][(c & 0xff) >> 2] >> ((c & 3) * 2)) & 3;\n"
+  "}\n\n"
+
+  "/* End of chdisplay.c */\n");
 
 return 0;
 }
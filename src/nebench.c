@@ -0,0 +1,371 @@
+/*************************************************
+*       The E text editor - 3rd incarnation      *
+*************************************************/
+
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
+
+/* Written by Philip Hazel, starting November 1991 */
+/* This file last modified: October 2026 */
+
+/* This file is not part of NE itself. It is an auxiliary program that times
+NE doing some common editing operations on synthetic files, so that changes in
+performance can be seen from one version to the next. It is built by "make
+bench" in the top-level directory, which also runs it.
+
+Each file is generated in a temporary directory, and for each operation NE is
+run in line mode with a -with file of commands. Every run is repeated, and the
+fastest time is used. The first operation, "load", just reads the file and
+stops; its time is subtracted from the others, so that they show the time for
+the operation itself. The output starts with comment lines beginning with #,
+including NE's version, followed by one line per measurement:
+
+  <file> <bytes> <operation> <seconds>
+
+The options are -ne <path> to give the NE to be timed (the default is ./ne),
+-r <n> to set the number of repeats (default 3), and -keep to leave the
+generated files in place. The argument, if present, is the approximate size of
+each file in megabytes (default 2). */
+
+#define _XOPEN_SOURCE 700
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#define SCRIPT_LINES  5000       /* commands in the "script" operation */
+
+static const char *ne = "./ne";
+static char dir[] = "/tmp/nebenchXXXXXX";
+static char path_in[64], path_out[64], path_cmd[64];
+static int repeats = 3;
+
+
+/* Words for the text files. Paragraphs of the ASCII and UTF-8 files are
+separated by empty lines, so that FORMAT has something to do. */
+
+static const char *words_ascii[] = {
+  "the", "quick", "brown", "fox", "jumps", "over", "lazy", "dogs.", "and",
+  "again", "editor", "line" };
+
+static const char *words_utf8[] = {
+  "caf\xc3\xa9", "na\xc3\xafve", "stra\xc3\x9f" "e", "the", "gar\xc3\xa7on",
+  "\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e", "\xe2\x82\xac" "5", "and",
+  "\xf0\x9f\x98\x80", "line", "\xc3\xa0", "fin." };
+
+enum { f_ascii, f_utf8, f_long, f_binary };
+
+typedef struct {
+  const char *name;
+  const char *option;        /* extra option for NE, or NULL */
+  int         type;
+} filestr;
+
+static filestr files[] = {
+  { "ascii",    NULL,         f_ascii },
+  { "utf8",     "-widechars", f_utf8 },
+  { "longline", NULL,         f_long },
+  { "binary",   "-binary",    f_binary }
+};
+
+
+/* The operations. A command list of NULL means the generated script, which
+consists of many simple cursor movements, so that it mostly measures the
+reading and obeying of commands. The "not" field lists the files for which an
+operation is skipped. */
+
+#define NOT(t) (1 << (t))
+
+typedef struct {
+  const char *name;
+  const char *commands;
+  int         not;
+} opstr;
+
+static opstr ops[] = {
+  { "load",      "stop", 0 },
+  { "save",      "w", 0 },
+  { "find",      "m0; f /absent-word/", 0 },
+  { "find-regex","m0; f r/[0-9]{6}q/", 0 },
+  { "bfind",     "m*; bf /absent-word/", 0 },
+  { "ge",        "m0; ge /the//THE/; stop", NOT(f_binary) },
+  { "m-end",     "100(m0; m*); stop", 0 },
+  { "cut-paste", "m0; mark lines; m*; p; cut; m0; paste; stop", 0 },
+  { "format",    "rmargin 60; m0; uteof(format); stop",
+                   NOT(f_long)|NOT(f_binary) },
+  { "script",    NULL, 0 }
+};
+
+
+
+/*************************************************
+*                   Timing                       *
+*************************************************/
+
+static double
+now(void)
+{
+struct timespec ts;
+clock_gettime(CLOCK_MONOTONIC, &ts);
+return ts.tv_sec + ts.tv_nsec/1e9;
+}
+
+
+/* Run NE once on the generated file with the current command file. The return
+code is not checked, because several operations end with a search that fails
+or with STOP, both of which give a non-zero code.
+
+Argument:  extra option or NULL
+Returns:   the elapsed time, or a negative value if NE could not be run
+*/
+
+static double
+runne(const char *option)
+{
+double start = now();
+int status;
+pid_t pid = fork();
+
+if (pid < 0) return -1.0;
+if (pid == 0)
+  {
+  int fd = open("/dev/null", O_RDWR);
+  dup2(fd, 0);
+  dup2(fd, 1);
+  dup2(fd, 2);
+  if (option != NULL)
+    execl(ne, ne, path_in, option, "-with", path_cmd, "-to", path_out,
+      "-noinit", (char *)NULL);
+  else
+    execl(ne, ne, path_in, "-with", path_cmd, "-to", path_out, "-noinit",
+      (char *)NULL);
+  _exit(127);
+  }
+
+if (waitpid(pid, &status, 0) < 0 ||
+    (WIFEXITED(status) && WEXITSTATUS(status) == 127))
+  return -1.0;
+return now() - start;
+}
+
+
+
+/*************************************************
+*              Generate a file                   *
+*************************************************/
+
+/* The long-line file is split into 16 lines. The binary file is random bytes.
+Digits are sprinkled through the text files so that the regular expression
+search has something to look at.
+
+Arguments:
+  type      the type of file
+  size      the approximate size in bytes
+
+Returns:    the number of lines, or 0 on failure
+*/
+
+static long int
+generate(int type, long int size)
+{
+FILE *f = fopen(path_in, "w");
+const char **words = (type == f_utf8)? words_utf8 : words_ascii;
+long int used = 0;
+long int lines = 0;
+int linelen = 0;
+
+if (f == NULL) return 0;
+srand(type);
+
+if (type == f_binary)
+  {
+  for (; used < size; used++) fputc(rand() & 0xff, f);
+  fclose(f);
+  return (size + 15)/16;
+  }
+
+while (used < size)
+  {
+  const char *w = words[rand() % 12];
+  int n = strlen(w);
+  int max = (type == f_long)? size/16 : 72;
+
+  if (linelen + n >= max)
+    {
+    fputc('\n', f);
+    used++;
+    lines++;
+    linelen = 0;
+    if (type != f_long && rand() % 8 == 0)
+      {
+      fputc('\n', f);
+      used++;
+      lines++;
+      }
+    }
+
+  if (linelen > 0)
+    {
+    fputc(' ', f);
+    used++;
+    linelen++;
+    }
+
+  if (rand() % 16 == 0) n = fprintf(f, "%d", rand() % 10000000);
+    else fputs(w, f);
+  used += n;
+  linelen += n;
+  }
+
+if (linelen > 0)
+  {
+  fputc('\n', f);
+  lines++;
+  }
+
+fclose(f);
+return lines;
+}
+
+
+/* Write the command file for an operation.
+
+Arguments:
+  op        the operation
+  lines     the number of lines in the file
+
+Returns:    non-zero if all went well
+*/
+
+static int
+writecommands(opstr *op, long int lines)
+{
+FILE *f = fopen(path_cmd, "w");
+if (f == NULL) return 0;
+
+if (op->commands != NULL) fprintf(f, "%s\n", op->commands); else
+  {
+  srand(lines);
+  for (int i = 0; i < SCRIPT_LINES; i++)
+    fprintf(f, "m%ld; %d>\n", 1 + rand() % lines, 1 + rand() % 40);
+  fprintf(f, "stop\n");
+  }
+
+return fclose(f) == 0;
+}
+
+
+
+/*************************************************
+*                 Main program                   *
+*************************************************/
+
+int
+main(int argc, char **argv)
+{
+long int size = 2;
+int keep = 0;
+int i;
+FILE *f;
+char buffer[256];
+
+for (i = 1; i < argc; i++)
+  {
+  if (strcmp(argv[i], "-ne") == 0 && i < argc - 1) ne = argv[++i];
+  else if (strcmp(argv[i], "-r") == 0 && i < argc - 1)
+    repeats = atoi(argv[++i]);
+  else if (strcmp(argv[i], "-keep") == 0) keep = 1;
+  else if (argv[i][0] != '-') size = atol(argv[i]);
+  else
+    {
+    printf("** Usage: nebench [-ne <path>] [-r <repeats>] [-keep] [<MB>]\n");
+    return 1;
+    }
+  }
+
+if (repeats < 1) repeats = 1;
+size *= 1024 * 1024;
+
+if (mkdtemp(dir) == NULL)
+  {
+  printf("** Failed to create a temporary directory\n");
+  return 1;
+  }
+sprintf(path_in, "%s/in", dir);
+sprintf(path_out, "%s/out", dir);
+sprintf(path_cmd, "%s/cmd", dir);
+
+/* Show the version of NE that is being timed. */
+
+sprintf(buffer, "%s -id", ne);
+f = popen(buffer, "r");
+if (f == NULL || fgets(buffer, sizeof(buffer), f) == NULL)
+  {
+  printf("** Failed to run %s\n", ne);
+  return 1;
+  }
+pclose(f);
+printf("# %s", buffer);
+printf("# file bytes operation seconds\n");
+
+for (size_t t = 0; t < sizeof(files)/sizeof(filestr); t++)
+  {
+  long int lines = generate(files[t].type, size);
+  double load = 0.0;
+
+  if (lines == 0)
+    {
+    printf("** Failed to create %s\n", path_in);
+    return 1;
+    }
+
+  for (size_t o = 0; o < sizeof(ops)/sizeof(opstr); o++)
+    {
+    double best = -1.0;
+
+    if ((ops[o].not & NOT(files[t].type)) != 0) continue;
+    if (!writecommands(ops + o, lines))
+      {
+      printf("** Failed to create %s\n", path_cmd);
+      return 1;
+      }
+
+    for (i = 0; i < repeats; i++)
+      {
+      double x = runne(files[t].option);
+      if (x < 0)
+        {
+        printf("** Failed to run %s\n", ne);
+        return 1;
+        }
+      if (best < 0 || x < best) best = x;
+      }
+
+    if (o == 0) load = best; else
+      {
+      best -= load;
+      if (best < 0) best = 0.0;
+      }
+
+    printf("%-8s %9ld %-10s %8.4f\n", files[t].name, size, ops[o].name, best);
+    fflush(stdout);
+    }
+  }
+
+if (!keep)
+  {
+  unlink(path_in);
+  unlink(path_out);
+  unlink(path_cmd);
+  rmdir(dir);
+  }
+else printf("# files left in %s\n", dir);
+
+return 0;
+}
+
+/* End of nebench.c */
@@ -0,0 +1,769 @@
+/*************************************************
+*       The E text editor - 3rd incarnation      *
+*************************************************/
+
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
+
+/* Written by Philip Hazel, starting November 1991 */
+/* This file last modified: October 2026 */
+
+/* This file is not part of NE itself. It is an auxiliary program that reads a
+trace written by NE's -trace option (see etrace.c for the format), and shows
+how long NE took to respond to each keystroke or command line, as a summary of
+each phase and a histogram of the total. It is built by "make nereplay" in the
+top-level directory.
+
+Unless -n is given, the session is then run again, so that a report of a slow
+session can be reproduced, and the same summary is shown for the new run. The
+files named on the recorded command line are copied into a temporary directory,
+and NE is run there with the recorded arguments, so nothing outside that
+directory is changed. The current contents of the files are used; if they have
+changed since the trace was made, the replay will not be exact.
+
+A screen session is replayed by turning the recorded input bytes into a
+-withkeys file and running NE on a pseudo-terminal of the recorded size, whose
+output is discarded. The terminal type is the recorded one; if it is an xterm,
+the queries that NE sends at startup are answered. When all the keystrokes
+have been used, NE waits for more, and is killed. With -headless, NE is instead
+run with its -headless option, which keeps the screen in memory, so that the
+display code can be timed without a terminal; if the session ends, the final
+screen is in the file .screen, which -keep preserves. A line-by-line session is replayed by turning the recorded
+command lines into a -with file.
+
+The options are -ne <path> to give the NE to be used (the default is ./ne),
+-n to show only the recorded times, -headless as described above, and -keep to
+leave the temporary directory in place. */
+
+#define _XOPEN_SOURCE 700
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#define LINESIZE   65536         /* Longest trace line */
+#define BUCKETS    24            /* Powers of two, from 1 microsecond */
+#define STALL      30            /* Seconds without progress before giving up */
+
+static const char *ne = "./ne";
+static char dir[] = "/tmp/nereplayXXXXXX";
+static char path_keys[64], path_cmds[64], path_trace[64], path_screen[64];
+
+/* Values from the trace header */
+
+static char term[256];
+static char cwd[4096];
+static int rows, cols, utf8;
+static char *argv_rec[256];
+static int argc_rec = 0;
+
+/* The times for one run */
+
+enum { ph_exec, ph_disp, ph_flush, ph_total, ph_count };
+static const char *phase_names[] = { "exec", "disp", "flush", "total" };
+
+typedef struct {
+  long int count;
+  long int size;
+  double  *times[ph_count];
+} runstr;
+
+
+
+/*************************************************
+*           Small JSON helpers                   *
+*************************************************/
+
+/* The trace is written by NE in a fixed form, so there is no need for a
+general JSON parser. This finds the value of a member in a line.
+
+Arguments:
+  line      the line
+  name      the member name
+
+Returns:    pointer to the value, or NULL
+*/
+
+static char *
+member(char *line, const char *name)
+{
+char key[64];
+char *p;
+sprintf(key, "\"%s\":", name);
+p = strstr(line, key);
+return (p == NULL)? NULL : p + strlen(key);
+}
+
+
+/* Copy a string value, removing the escapes that NE puts in. A damaged value
+that ends inside an escape is cut short there.
+
+Arguments:
+  p         points to the opening quote
+  buff      where to put the value
+  size      size of the buffer
+  endp      if not NULL, where to return the end of the value
+
+Returns:    the length of the value
+*/
+
+static int
+getstring(char *p, char *buff, int size, char **endp)
+{
+int n = 0;
+if (*p++ != '"') { buff[0] = 0; return 0; }
+while (*p != 0 && *p != '"' && n < size - 1)
+  {
+  int c = *p++;
+  if (c == '\\')
+    {
+    if (*p == 0) break;
+    c = *p++;
+    if (c == 'u')
+      {
+      char hex[5];
+      int i;
+      for (i = 0; i < 4 && isxdigit((unsigned char)p[i]); i++) hex[i] = p[i];
+      if (i < 4) break;
+      hex[4] = 0;
+      c = (int)strtol(hex, NULL, 16);
+      p += 4;
+      }
+    }
+  buff[n++] = c;
+  }
+buff[n] = 0;
+if (endp != NULL) *endp = (*p == '"')? p + 1 : p;
+return n;
+}
+
+
+
+/*************************************************
+*             Read a trace                       *
+*************************************************/
+
+/* The times are collected in a run structure. If the keys or commands file is
+open, the input bytes or command lines are written to it.
+
+Arguments:
+  name      the trace file
+  run       the run structure
+  header    TRUE to take values from the header
+  keys      the -withkeys file, or NULL
+  cmds      the -with file, or NULL
+
+Returns:    the number of keystroke records, or -1 on failure
+*/
+
+static long int
+readtrace(const char *name, runstr *run, int header, FILE *keys, FILE *cmds)
+{
+FILE *f = fopen(name, "r");
+static char line[LINESIZE];
+static char buff[LINESIZE];
+long int nkeys = 0;
+
+if (f == NULL) return -1;
+run->count = 0;
+
+while (fgets(line, sizeof(line), f) != NULL)
+  {
+  char *p;
+  double t[ph_count];
+
+  /* The header */
+
+  if ((p = member(line, "ne")) != NULL)
+    {
+    if (!header) continue;
+    if ((p = member(line, "term")) != NULL)
+      getstring(p, term, sizeof(term), NULL);
+    if ((p = member(line, "rows")) != NULL) rows = atoi(p);
+    if ((p = member(line, "cols")) != NULL) cols = atoi(p);
+    if ((p = member(line, "utf8")) != NULL) utf8 = strncmp(p, "true", 4) == 0;
+    if ((p = member(line, "cwd")) != NULL)
+      getstring(p, cwd, sizeof(cwd), NULL);
+    if ((p = member(line, "argv")) != NULL && *p == '[')
+      {
+      p++;
+      while (*p == '"' && argc_rec < 255)
+        {
+        int n = getstring(p, buff, sizeof(buff), &p);
+        argv_rec[argc_rec] = malloc(n + 1);
+        strcpy(argv_rec[argc_rec++], buff);
+        if (*p == ',') p++;
+        }
+      }
+    continue;
+    }
+
+  /* An event */
+
+  if ((p = member(line, "exec")) == NULL) continue;
+  t[ph_exec] = strtod(p, NULL);
+  t[ph_disp] = ((p = member(line, "disp")) == NULL)? 0 : strtod(p, NULL);
+  t[ph_flush] = ((p = member(line, "flush")) == NULL)? 0 : strtod(p, NULL);
+  t[ph_total] = t[ph_exec] + t[ph_disp] + t[ph_flush];
+
+  if (run->count >= run->size)
+    {
+    run->size = (run->size == 0)? 1024 : run->size * 2;
+    for (int i = 0; i < ph_count; i++)
+      run->times[i] = realloc(run->times[i], run->size * sizeof(double));
+    }
+  for (int i = 0; i < ph_count; i++) run->times[i][run->count] = t[i];
+  run->count++;
+
+  if ((p = member(line, "in")) != NULL)
+    {
+    int n = getstring(p, buff, sizeof(buff), NULL);
+    nkeys++;
+    if (keys != NULL)
+      {
+      for (int i = 0; i + 1 < n; i += 2)
+        fprintf(keys, "\\%c%c", buff[i], buff[i+1]);
+      fprintf(keys, "\n");
+      }
+    }
+
+  else if ((p = member(line, "cmd")) != NULL && cmds != NULL)
+    {
+    getstring(p, buff, sizeof(buff), NULL);
+    fprintf(cmds, "%s\n", buff);
+    }
+  }
+
+fclose(f);
+return nkeys;
+}
+
+
+
+/*************************************************
+*            Show the times for a run            *
+*************************************************/
+
+static int
+compare(const void *a, const void *b)
+{
+double x = *(const double *)a;
+double y = *(const double *)b;
+return (x < y)? -1 : (x > y)? 1 : 0;
+}
+
+static void
+report(const char *title, runstr *run)
+{
+long int n = run->count;
+long int hist[BUCKETS];
+long int most = 0;
+
+printf("# %s: %ld events; times in microseconds\n", title, n);
+if (n == 0) return;
+
+printf("# phase        mean       p50       p90       p99       max\n");
+for (int i = 0; i < ph_count; i++)
+  {
+  double *t = run->times[i];
+  double sum = 0;
+  for (long int k = 0; k < n; k++) sum += t[k];
+  qsort(t, n, sizeof(double), compare);
+  printf("%-8s %9.0f %9.0f %9.0f %9.0f %9.0f\n", phase_names[i], sum/n,
+    t[n/2], t[(n*9)/10], t[(n*99)/100], t[n-1]);
+  }
+
+/* The histogram of the total, which is now sorted. */
+
+for (int i = 0; i < BUCKETS; i++) hist[i] = 0;
+for (long int k = 0; k < n; k++)
+  {
+  int b = 0;
+  while (b < BUCKETS - 1 && run->times[ph_total][k] > (double)(1L << b)) b++;
+  hist[b]++;
+  }
+for (int i = 0; i < BUCKETS; i++) if (hist[i] > most) most = hist[i];
+
+printf("# histogram of total\n");
+for (int i = 0; i < BUCKETS; i++)
+  {
+  int w;
+  if (hist[i] == 0) continue;
+  w = (int)((hist[i] * 50 + most - 1) / most);
+  printf("<= %9ld %8ld  %.*s\n", 1L << i, hist[i], w,
+    "##################################################");
+  }
+}
+
+
+
+/*************************************************
+*        Copy a file into the directory          *
+*************************************************/
+
+/* Arguments that name existing files are copied, and replaced by their base
+names, which NE then finds in the temporary directory. Other file names are
+also reduced to base names, so that anything NE writes stays there.
+
+Arguments:
+  name      the name from the recorded command line
+  copy      TRUE if the file should be copied if it exists
+
+Returns:    the name to use in the replay
+*/
+
+static char *
+localname(char *name, int copy)
+{
+char path[8192];
+char *base = strrchr(name, '/');
+FILE *in, *out;
+struct stat st;
+int c;
+
+base = (base == NULL)? name : base + 1;
+if (!copy || strcmp(name, "-") == 0) return (strcmp(name, "-") == 0)? name : base;
+
+if (name[0] == '/') snprintf(path, sizeof(path), "%s", name);
+  else snprintf(path, sizeof(path), "%s/%s", cwd, name);
+
+if (stat(path, &st) != 0 || !S_ISREG(st.st_mode)) return base;
+in = fopen(path, "rb");
+snprintf(path, sizeof(path), "%s/%s", dir, base);
+out = fopen(path, "wb");
+if (in != NULL && out != NULL)
+  while ((c = getc(in)) != EOF) putc(c, out);
+if (in != NULL) fclose(in);
+if (out != NULL) fclose(out);
+return base;
+}
+
+
+
+/*************************************************
+*     Count the records in the new trace         *
+*************************************************/
+
+static long int
+countlines(void)
+{
+FILE *f = fopen(path_trace, "r");
+long int n = 0;
+int c;
+if (f == NULL) return 0;
+while ((c = getc(f)) != EOF) if (c == '\n') n++;
+fclose(f);
+return n;
+}
+
+
+
+/*************************************************
+*         Run NE on a pseudo-terminal            *
+*************************************************/
+
+/* The output is read and discarded, except that queries from NE are answered
+as an xterm would. NE is killed when it has used all the keystrokes and gone
+quiet, or if it makes no progress for a long time.
+
+Arguments:
+  args      the arguments for NE
+  expect    the number of records expected in the new trace
+
+Returns:    0 if all went well
+*/
+
+static int
+runpty(char **args, long int expect)
+{
+struct winsize ws;
+char buff[4096];
+char tail[16];
+int taillen = 0;
+int master = posix_openpt(O_RDWR|O_NOCTTY);
+long int lines = 0;
+time_t progress = time(NULL);
+pid_t pid;
+
+if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0)
+  {
+  printf("** Failed to create a pseudo-terminal: %s\n", strerror(errno));
+  return 1;
+  }
+
+memset(&ws, 0, sizeof(ws));
+ws.ws_row = (rows > 0)? rows : 24;
+ws.ws_col = (cols > 0)? cols : 80;
+(void)ioctl(master, TIOCSWINSZ, &ws);
+
+pid = fork();
+if (pid < 0) return 1;
+if (pid == 0)
+  {
+  int slave;
+  setsid();
+  slave = open(ptsname(master), O_RDWR);
+  if (slave < 0) _exit(127);
+  dup2(slave, 0);
+  dup2(slave, 1);
+  dup2(slave, 2);
+  close(master);
+  if (term[0] != 0) setenv("TERM", term, 1);
+  execv(ne, args);
+  _exit(127);
+  }
+
+for (;;)
+  {
+  struct pollfd pfd;
+  int status;
+  long int n;
+
+  if (waitpid(pid, &status, WNOHANG) == pid)
+    {
+    close(master);
+    return (WIFEXITED(status) && WEXITSTATUS(status) == 127)? 1 : 0;
+    }
+
+  pfd.fd = master;
+  pfd.events = POLLIN;
+  if (poll(&pfd, 1, 1000) > 0)
+    {
+    ssize_t len = read(master, buff, sizeof(buff));
+    if (len > 0)
+      {
+      /* Look for queries, allowing for them to be split between reads. The
+      end of the previous read is kept, but a query that lies wholly within it
+      has already been answered. */
+
+      char scan[sizeof(buff) + sizeof(tail)];
+      memcpy(scan, tail, taillen);
+      memcpy(scan + taillen, buff, len);
+      len += taillen;
+      for (ssize_t i = 0; i < len; i++)
+        {
+        if (i + 4 <= len && i + 4 > taillen &&
+            memcmp(scan + i, "\033[6n", 4) == 0)
+          {
+          if (write(master, utf8? "\033[2;3R" : "\033[2;4R", 6)){};
+          }
+        else if (i + 5 <= len && memcmp(scan + i, "\033[>0c", 5) == 0)
+          {
+          if (write(master, "\033[>0;95;0c", 10)){};
+          }
+        }
+      taillen = (len < 4)? (int)len : 4;
+      memcpy(tail, scan + len - taillen, taillen);
+      progress = time(NULL);
+      continue;
+      }
+    }
+
+  /* Nothing to read for a second. */
+
+  n = countlines();
+  if (n != lines)
+    {
+    lines = n;
+    progress = time(NULL);
+    }
+  if (lines > expect || time(NULL) - progress > STALL)
+    {
+    if (lines <= expect) printf("** The replay stalled\n");
+    kill(pid, SIGKILL);
+    (void)waitpid(pid, &status, 0);
+    close(master);
+    return 0;
+    }
+  }
+}
+
+
+
+/*************************************************
+*        Run NE with a screen in memory          *
+*************************************************/
+
+/* The standard input is a pipe to which nothing is written, so that NE waits
+when it has used all the keystrokes, and is then killed, as for a
+pseudo-terminal. The screen size is passed in LINES and COLUMNS.
+
+Arguments:
+  args      the arguments for NE
+  expect    the number of records expected in the new trace
+
+Returns:    0 if all went well
+*/
+
+static int
+runheadless(char **args, long int expect)
+{
+int fds[2];
+long int lines = 0;
+time_t progress = time(NULL);
+pid_t pid;
+
+if (pipe(fds) != 0) return 1;
+pid = fork();
+if (pid < 0) return 1;
+if (pid == 0)
+  {
+  char size[16];
+  int fd = open("/dev/null", O_RDWR);
+  dup2(fds[0], 0);
+  dup2(fd, 1);
+  dup2(fd, 2);
+  close(fds[1]);
+  if (term[0] != 0) setenv("TERM", term, 1);
+  sprintf(size, "%d", (rows > 0)? rows : 24);
+  setenv("LINES", size, 1);
+  sprintf(size, "%d", (cols > 0)? cols : 80);
+  setenv("COLUMNS", size, 1);
+  execv(ne, args);
+  _exit(127);
+  }
+close(fds[0]);
+
+for (;;)
+  {
+  int status;
+  long int n;
+
+  if (waitpid(pid, &status, WNOHANG) == pid)
+    {
+    close(fds[1]);
+    return (WIFEXITED(status) && WEXITSTATUS(status) == 127)? 1 : 0;
+    }
+
+  (void)poll(NULL, 0, 100);
+  n = countlines();
+  if (n != lines)
+    {
+    lines = n;
+    progress = time(NULL);
+    }
+  if (lines > expect || time(NULL) - progress > STALL)
+    {
+    if (lines <= expect) printf("** The replay stalled\n");
+    kill(pid, SIGKILL);
+    (void)waitpid(pid, &status, 0);
+    close(fds[1]);
+    return 0;
+    }
+  }
+}
+
+
+
+/*************************************************
+*          Run NE with a command file            *
+*************************************************/
+
+static int
+runlines(char **args)
+{
+int status;
+pid_t pid = fork();
+
+if (pid < 0) return 1;
+if (pid == 0)
+  {
+  int fd = open("/dev/null", O_RDWR);
+  dup2(fd, 0);
+  dup2(fd, 1);
+  dup2(fd, 2);
+  execv(ne, args);
+  _exit(127);
+  }
+
+if (waitpid(pid, &status, 0) < 0 ||
+    (WIFEXITED(status) && WEXITSTATUS(status) == 127))
+  return 1;
+return 0;
+}
+
+
+
+/*************************************************
+*          Remove the temporary directory        *
+*************************************************/
+
+static void
+removedir(void)
+{
+DIR *d = opendir(dir);
+struct dirent *e;
+char path[8192];
+
+if (d == NULL) return;
+while ((e = readdir(d)) != NULL)
+  {
+  if (strcmp(e->d_name, ".") == 0 || strcmp(e->d_name, "..") == 0) continue;
+  snprintf(path, sizeof(path), "%s/%s", dir, e->d_name);
+  unlink(path);
+  }
+closedir(d);
+rmdir(dir);
+}
+
+
+
+/*************************************************
+*                 Main program                   *
+*************************************************/
+
+int
+main(int argc, char **argv)
+{
+const char *trace = NULL;
+char *args[300];
+char nepath[4096];
+int replay = 1;
+int headless = 0;
+int keep = 0;
+int nargs = 0;
+int rc = 0;
+long int nkeys;
+FILE *keys, *cmds;
+runstr recorded, replayed;
+
+for (int i = 1; i < argc; i++)
+  {
+  if (strcmp(argv[i], "-ne") == 0 && i < argc - 1) ne = argv[++i];
+  else if (strcmp(argv[i], "-n") == 0) replay = 0;
+  else if (strcmp(argv[i], "-headless") == 0) headless = 1;
+  else if (strcmp(argv[i], "-keep") == 0) keep = 1;
+  else if (argv[i][0] != '-' && trace == NULL) trace = argv[i];
+  else trace = NULL, i = argc;
+  }
+
+if (trace == NULL)
+  {
+  printf("** Usage: nereplay [-ne <path>] [-n] [-headless] [-keep] <trace>\n");
+  return 1;
+  }
+
+memset(&recorded, 0, sizeof(recorded));
+memset(&replayed, 0, sizeof(replayed));
+
+if (readtrace(trace, &recorded, 1, NULL, NULL) < 0)
+  {
+  printf("** Failed to read %s: %s\n", trace, strerror(errno));
+  return 1;
+  }
+report("recorded", &recorded);
+if (!replay) return 0;
+
+if (argc_rec == 0)
+  {
+  printf("** %s has no header, so cannot be replayed\n", trace);
+  return 1;
+  }
+
+/* NE is run in the temporary directory, so make its path absolute. */
+
+if (strchr(ne, '/') != NULL && ne[0] != '/')
+  {
+  if (getcwd(nepath, sizeof(nepath) - strlen(ne) - 2) == NULL) return 1;
+  strcat(nepath, "/");
+  strcat(nepath, ne);
+  ne = nepath;
+  }
+
+if (mkdtemp(dir) == NULL)
+  {
+  printf("** Failed to create a temporary directory\n");
+  return 1;
+  }
+sprintf(path_keys, "%s/.keys", dir);
+sprintf(path_cmds, "%s/.cmds", dir);
+sprintf(path_trace, "%s/.trace", dir);
+sprintf(path_screen, "%s/.screen", dir);
+
+keys = fopen(path_keys, "w");
+cmds = fopen(path_cmds, "w");
+if (keys == NULL || cmds == NULL)
+  {
+  printf("** Failed to create files in %s\n", dir);
+  return 1;
+  }
+nkeys = readtrace(trace, &replayed, 0, keys, cmds);
+fclose(keys);
+fclose(cmds);
+
+/* Build the arguments. The recorded input and trace options are replaced by
+new ones. */
+
+args[nargs++] = (char *)ne;
+for (int i = 1; i < argc_rec && nargs < 290; i++)
+  {
+  char *a = argv_rec[i];
+  if (strcmp(a, "-with") == 0 || strcmp(a, "-withkeys") == 0 ||
+      strcmp(a, "-wks") == 0 || strcmp(a, "-trace") == 0 ||
+      strcmp(a, "-headless") == 0)
+    i++;
+  else if (strcmp(a, "-to") == 0 || strcmp(a, "-o") == 0 ||
+           strcmp(a, "-ver") == 0)
+    {
+    args[nargs++] = a;
+    if (i < argc_rec - 1) args[nargs++] = localname(argv_rec[++i], 0);
+    }
+  else if (strcmp(a, "-opt") == 0 || strcmp(a, "-from") == 0)
+    {
+    args[nargs++] = a;
+    if (i < argc_rec - 1)
+      {
+      i++;
+      args[nargs++] = (a[1] == 'f')? localname(argv_rec[i], 1) : argv_rec[i];
+      }
+    }
+  else if (a[0] == '-' && a[1] != 0) args[nargs++] = a;
+  else args[nargs++] = localname(a, 1);
+  }
+
+args[nargs++] = "-trace";
+args[nargs++] = path_trace;
+args[nargs++] = (nkeys > 0)? "-withkeys" : "-with";
+args[nargs++] = (nkeys > 0)? path_keys : path_cmds;
+if (headless && nkeys > 0)
+  {
+  args[nargs++] = "-headless";
+  args[nargs++] = path_screen;
+  }
+args[nargs] = NULL;
+
+if (chdir(dir) != 0)
+  {
+  printf("** Failed to change to %s\n", dir);
+  return 1;
+  }
+
+rc = (nkeys == 0)? runlines(args) :
+     headless? runheadless(args, nkeys) : runpty(args, nkeys);
+if (rc != 0) printf("** Failed to run %s\n", ne); else
+  {
+  if (readtrace(path_trace, &replayed, 0, NULL, NULL) < 0)
+    {
+    printf("** No trace was written by %s\n", ne);
+    rc = 1;
+    }
+  else report("replayed", &replayed);
+  }
+
+if (chdir("/") != 0) {};
+if (keep) printf("# files left in %s\n", dir); else removedir();
+return rc;
+}
+
+/* End of nereplay.c */
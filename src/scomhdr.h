@@ -2,10 +2,10 @@
 *       The E text editor - 3rd incarnation      *
 *************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2023 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: February 2023 */
+/* This file last modified: October 2026 */
 
 /* This header file is the interface between the "common" screen handling
 functions and the system-dependent screen driver. */
@@ -21,6 +21,9 @@ typedef struct {
 /*  Functions */
 
 extern void scommon_select(void);
+extern void headless_end(void);
+extern void headless_keywait(void);
+extern void headless_select(uschar *);
 
 extern void  (*sys_w_cls)(int, int, int, int);
 extern void  (*sys_w_flush)(void);
@@ -5,7 +5,7 @@
 /* Copyright (c) University of Cambridge 1991 - 2023 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: January 2023 */
+/* This file last modified: October 2026 */
 
 
 /* This file contains screen-handling code for those systems that process
@@ -28,6 +28,11 @@ NE, some of this is a bit of overkill, but it may come in useful one day. */
 
 #define sc_maxwindow  10
 
+/* A double-width character is held in the buffer entry for its left-hand cell;
+the entry for its right-hand cell holds this value. */
+
+#define sc_wide       0xffffffffu
+
 
 
 /*************************************************
@@ -175,13 +180,22 @@ showrow(usint srow, usint left, usint right)
 sc_buffstr *p = sc_buffwindow + srow*sc_screenwidth + left;
 if (right > window_width) right = window_width;
 
+/* Start at the left-hand half of a double-width character. */
+
+if (left > 0 && p->ch == sc_wide)
+  {
+  left--;
+  p--;
+  }
+
 sys_w_move(left, srow + sc_windowtop);
 
-for (usint i = left; i <= right; i++)
+for (usint i = left; i <= right; i++, p++)
   {
   usint r = p->rend;
+  if (p->ch == sc_wide) continue;
   if (r != sc_setrendition) forcerendition(r);
-  sys_w_putc((p++)->ch);
+  sys_w_putc(p->ch);
   }
 
 sys_w_move(sc_col, sc_row + sc_windowtop);
@@ -298,14 +312,38 @@ sc_rendition = r;
 *          Write a character                     *
 *************************************************/
 
+/* A double-width character uses two cells. If there is only one cell left on
+the line, the substitution character is written instead. Writing over either
+half of a double-width character blanks the other half, which is what a
+terminal does. */
+
 static void
 scommon_putc(int c)
 {
+usint cells = CHARCELLS(c);
+
+if (cells > 1 && sc_col >= screen_max_col)
+  {
+  c = screen_subchar;
+  cells = 1;
+  }
+
 if (sc_setrendition != sc_rendition) forcerendition(sc_rendition);
 sys_w_putc(c);
+
+if (sc_buffptr->ch == sc_wide && sc_col > 0) sc_buffptr[-1] = sc_space;
+if (sc_col + cells <= screen_max_col && sc_buffptr[cells].ch == sc_wide)
+  sc_buffptr[cells] = sc_space;
+
 sc_buffptr->ch = c;
 sc_buffptr->rend = sc_rendition;
-if (sc_col < screen_max_col)
+if (cells > 1)
+  {
+  sc_buffptr[1].ch = sc_wide;
+  sc_buffptr[1].rend = sc_rendition;
+  }
+
+while (cells-- > 0 && sc_col < screen_max_col)
   {
   sc_col++;
   sc_buffptr++;
@@ -346,8 +384,17 @@ scommon_eraseright(void)
 BOOL moveneeded = TRUE;
 BOOL anydone = FALSE;
 sc_buffstr *ptr = sc_buffptr;
+usint start = sc_col;
+
+/* Erasing the right-hand half of a double-width character erases it all. */
+
+if (ptr->ch == sc_wide && start > 0)
+  {
+  ptr--;
+  start--;
+  }
 
-for (usint i = sc_col; i <= sc_maxcol; i++)
+for (usint i = start; i <= sc_maxcol; i++)
   {
   if (ptr->ch == ' ' && ptr->rend == s_r_normal) moveneeded = TRUE; else
     {
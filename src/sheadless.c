@@ -0,0 +1,320 @@
+/*************************************************
+*       The E text editor - 3rd incarnation      *
+*************************************************/
+
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
+
+/* Written by Philip Hazel, starting November 1991 */
+/* This file last modified: October 2026 */
+
+
+/* This file contains a screen driver that keeps the screen in memory instead
+of writing it to a terminal. It is selected by the -headless command line
+option, so that the screen handling can be measured and tested without a
+terminal; the keystrokes normally come from a -withkeys file. Each call of the
+driver is counted, as are the bytes of characters that a UTF-8 terminal would
+have been sent. At the end of the run, the counts, the cursor position, and the
+final contents of the screen are written to the file that -headless names. The
+cursor position when NE last waited for a keystroke in its main loop is also
+given, because at the end the cursor is usually on the command line. */
+
+
+#include "ehdr.h"
+#include "shdr.h"
+#include "scomhdr.h"
+
+
+/* The right-hand cell of a double-width character holds this value. */
+
+#define hl_wide  0xffffffffu
+
+enum { op_cls, op_flush, op_move, op_rendition, op_putc, op_hscroll,
+  op_vscroll, op_count };
+
+static const char *opnames[] = {
+  "cls", "flush", "move", "rendition", "putc", "hscroll", "vscroll" };
+
+static FILE  *hl_fid;
+static sc_buffstr *hl_frame = NULL;
+static unsigned long int hl_ops[op_count];
+static unsigned long int hl_bytes = 0;
+
+static int hl_width;               /* screen width */
+static int hl_depth;               /* screen depth */
+static int hl_col = 0;             /* cursor column */
+static int hl_row = 0;             /* cursor row */
+static int hl_keycol = 0;          /* cursor column at last main loop wait */
+static int hl_keyrow = 0;          /* cursor row at last main loop wait */
+static int hl_rendition = s_r_normal;
+
+
+
+/*************************************************
+*           Clear part of a row                  *
+*************************************************/
+
+static void
+clearcells(int row, int left, int right)
+{
+sc_buffstr *p = hl_frame + row*hl_width;
+for (int i = left; i <= right; i++)
+  {
+  p[i].ch = ' ';
+  p[i].rend = s_r_normal;
+  }
+}
+
+
+
+/*************************************************
+*               Clear a rectangle                *
+*************************************************/
+
+static void
+headless_cls(int bottom, int left, int top, int right)
+{
+hl_ops[op_cls]++;
+for (int i = top; i <= bottom; i++) clearcells(i, left, right);
+hl_rendition = s_r_normal;
+}
+
+
+
+/*************************************************
+*                   Flush                        *
+*************************************************/
+
+static void
+headless_flush(void)
+{
+hl_ops[op_flush]++;
+}
+
+
+
+/*************************************************
+*               Move the cursor                  *
+*************************************************/
+
+static void
+headless_move(int x, int y)
+{
+hl_ops[op_move]++;
+hl_col = x;
+hl_row = y;
+}
+
+
+
+/*************************************************
+*              Set the rendition                 *
+*************************************************/
+
+static void
+headless_rendition(int r)
+{
+hl_ops[op_rendition]++;
+hl_rendition = r;
+}
+
+
+
+/*************************************************
+*             Write a character                  *
+*************************************************/
+
+/* The character is counted in the same way as the terminal driver sends it. A
+character that would go beyond the right-hand edge is dropped. As on a
+terminal, overwriting either half of a double-width character blanks the other
+half.
+
+Argument:  the character
+Returns:   nothing
+*/
+
+static void
+headless_putc(int c)
+{
+uschar buff[8];
+int cells, len;
+sc_buffstr *p;
+
+if (ch_width(c) == 0) c = screen_subchar;
+cells = CHARCELLS(c);
+len = (c < 128)? 1 : ord2utf8(c, buff);
+
+hl_ops[op_putc]++;
+hl_bytes += len;
+main_stats.screen_bytes += len;
+
+if (hl_col + cells > hl_width) return;
+p = hl_frame + hl_row*hl_width + hl_col;
+if (p->ch == hl_wide && hl_col > 0) clearcells(hl_row, hl_col - 1, hl_col - 1);
+if (hl_col + cells < hl_width && p[cells].ch == hl_wide)
+  clearcells(hl_row, hl_col + cells, hl_col + cells);
+p->ch = c;
+p->rend = hl_rendition;
+if (cells > 1)
+  {
+  p[1].ch = hl_wide;
+  p[1].rend = hl_rendition;
+  }
+hl_col += cells;
+}
+
+
+
+/*************************************************
+*           Scroll part of the screen            *
+*************************************************/
+
+/* For a vertical scroll, a positive amount moves the rows down and a negative
+amount moves them up. Rows that are uncovered are cleared. */
+
+static void
+headless_vscroll(int bottom, int top, int amount)
+{
+hl_ops[op_vscroll]++;
+if (amount > 0)
+  {
+  for (int i = bottom - amount; i >= top; i--)
+    memcpy(hl_frame + (i + amount)*hl_width, hl_frame + i*hl_width,
+      hl_width*sizeof(sc_buffstr));
+  for (int i = top; i < top + amount; i++) clearcells(i, 0, hl_width - 1);
+  }
+else
+  {
+  amount = -amount;
+  for (int i = top + amount; i <= bottom; i++)
+    memcpy(hl_frame + (i - amount)*hl_width, hl_frame + i*hl_width,
+      hl_width*sizeof(sc_buffstr));
+  for (int i = bottom - amount + 1; i <= bottom; i++)
+    clearcells(i, 0, hl_width - 1);
+  }
+}
+
+
+/* For a horizontal scroll, a positive amount inserts spaces at the left of
+the area and a negative amount deletes characters there. */
+
+static void
+headless_hscroll(int left, int bottom, int right, int top, int amount)
+{
+hl_ops[op_hscroll]++;
+for (int i = top; i <= bottom; i++)
+  {
+  sc_buffstr *p = hl_frame + i*hl_width;
+  if (amount > 0)
+    {
+    memmove(p + left + amount, p + left,
+      (right - left + 1 - amount)*sizeof(sc_buffstr));
+    clearcells(i, left, left + amount - 1);
+    }
+  else
+    {
+    memmove(p + left, p + left - amount,
+      (right - left + 1 + amount)*sizeof(sc_buffstr));
+    clearcells(i, right + amount + 1, right);
+    }
+  }
+}
+
+
+
+/*************************************************
+*             Select this driver                 *
+*************************************************/
+
+/* This is called at the start of a screen run instead of setting up the
+terminal. The screen size has already been set.
+
+Argument:  the name of the file for the results
+Returns:   nothing; failure to open the file is a hard error
+*/
+
+void
+headless_select(uschar *name)
+{
+hl_fid = sys_fopen(name, US"w");
+if (hl_fid == NULL)
+  error_moan(5, name, "writing", strerror(errno));  /* Hard */
+
+hl_width = screen_max_col + 1;
+hl_depth = screen_max_row + 1;
+hl_frame = store_Xget(hl_width*hl_depth*sizeof(sc_buffstr));
+for (int i = 0; i < hl_depth; i++) clearcells(i, 0, hl_width - 1);
+
+sys_w_cls = headless_cls;
+sys_w_flush = headless_flush;
+sys_w_move = headless_move;
+sys_w_rendition = headless_rendition;
+sys_w_putc = headless_putc;
+sys_w_hscroll = headless_hscroll;
+sys_w_vscroll = headless_vscroll;
+}
+
+
+
+/*************************************************
+*       Note a wait for a main loop keystroke    *
+*************************************************/
+
+/* This is called at the top of the main screen loop, where the cursor is in
+the text, or wherever the previous keystroke left it.
+
+Arguments:  none
+Returns:    nothing
+*/
+
+void
+headless_keywait(void)
+{
+hl_keycol = hl_col;
+hl_keyrow = hl_row;
+}
+
+
+
+/*************************************************
+*            Write the results                   *
+*************************************************/
+
+/* This is called at the end of the screen run. Trailing spaces are removed
+from the rows of the screen.
+
+Arguments:  none
+Returns:    nothing
+*/
+
+void
+headless_end(void)
+{
+fprintf(hl_fid, "Screen %dx%d, cursor at row %d column %d\n", hl_depth,
+  hl_width, hl_row, hl_col);
+fprintf(hl_fid, "Last keystroke wait with cursor at row %d column %d\n",
+  hl_keyrow, hl_keycol);
+for (int i = 0; i < op_count; i++)
+  fprintf(hl_fid, "%-10s %lu\n", opnames[i], hl_ops[i]);
+fprintf(hl_fid, "%-10s %lu\n", "bytes", hl_bytes);
+fprintf(hl_fid, "--------\n");
+
+for (int i = 0; i < hl_depth; i++)
+  {
+  sc_buffstr *p = hl_frame + i*hl_width;
+  int n = hl_width;
+  while (n > 0 && p[n-1].ch == ' ') n--;
+  for (int j = 0; j < n; j++)
+    {
+    uschar buff[8];
+    if (p[j].ch == hl_wide) continue;
+    buff[ord2utf8(p[j].ch, buff)] = 0;
+    fputs(CS buff, hl_fid);
+    }
+  fputc('\n', hl_fid);
+  }
+
+fprintf(hl_fid, "--------\n");
+fclose(hl_fid);
+}
+
+/* End of sheadless.c */
@@ -2,10 +2,10 @@
 *       The E text editor - 3rd incarnation      *
 *************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2024 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: September 2024 */
+/* This file last modified: October 2026 */
 
 /* This file contains all the structure definitions, together with parameters
 that control the size of some of them. */
@@ -31,18 +31,31 @@ typedef struct line {
   uschar      *text;         /* the characters themselves */
   int          key;          /* line number */
   usint        len;          /* number of bytes */
-  uschar       flags;        /* various flag bits */
+  usint        undostep;     /* undo step in which text was last saved */
+  usint        flags;        /* various flag bits */
 } linestr;
 
-/* Bits in line flags byte */
+/* Bits in line flags */
 
 #define lf_eof     1         /* eof line */
 #define lf_shn     2         /* show needed */
 #define lf_clend   4         /* clear out end of line */
 #define lf_tabs    8         /* expanded tabs in this line */
 #define lf_udch   16         /* chars for undelete */
+#define lf_back   32         /* temporary: line is in the back list */
+#define lf_ascii  64         /* no multibyte characters in the text */
+#define lf_index 128         /* the text may have a character index */
+#define lf_utf8  256         /* the text is valid UTF-8 */
+#define lf_badutf8 512       /* the text is not valid UTF-8 */
+#define lf_narrow 1024       /* no double-width characters in the text */
+#define lf_layout 2048       /* the text may have a column layout */
+#define lf_rowstart 4096     /* the text may have a screen row offset */
 #define lf_shbits (lf_shn|lf_clend)  /* show request bits */
 
+/* Bits that describe the text, cleared when it changes */
+
+#define lf_chbits (lf_ascii|lf_index|lf_utf8|lf_badutf8|lf_narrow|lf_layout| \
+  lf_rowstart)
 
 /* Entry in "back" vector */
 
@@ -52,10 +65,79 @@ typedef struct {
 } backstr;
 
 
+/* Undo journal record and step; see eundo.c for details. */
+
+typedef struct undorec {
+  struct undorec *next;      /* next (older) record in the step */
+  linestr *first;            /* changed line, or first line of a block */
+  linestr *last;             /* last line of a block */
+  linestr *prev;             /* line before a removed block */
+  linestr *after;            /* line after a removed block */
+  uschar  *text;             /* saved text */
+  size_t   size;             /* bytes of saved text or of block lines */
+  usint    len;              /* saved length */
+  int      key;              /* saved line number */
+  int      count;            /* number of lines in a block */
+  uschar   type;             /* see below */
+  usint    flags;            /* saved line flags */
+} undorec;
+
+#define ur_text    1         /* saved text of a changed line */
+#define ur_insert  2         /* block of lines inserted */
+#define ur_remove  3         /* block of lines removed */
+
+typedef struct undostep {
+  struct undostep *next;     /* next older step (next newer in redo list) */
+  struct undostep *prev;     /* next newer step in undo list */
+  undorec *records;          /* records, newest first */
+  linestr *line;             /* cursor line before the step */
+  linestr *afterline;        /* cursor line after the step */
+  size_t   size;             /* memory held by the step */
+  int      col;              /* cursor column before the step */
+  int      aftercol;         /* cursor column after the step */
+  usint    stepno;           /* the step's number */
+} undostep;
+
+
+/* Identification of a file, for checking that a journal's base file has not
+changed. */
+
+typedef struct {
+  long size;
+  long mtime;
+  long inode;
+} stampstr;
+
+
+/* Crash-recovery journal; see ejournal.c for details. */
+
+typedef struct journalstr {
+  FILE     *fid;             /* journal file, or NULL if not yet started */
+  uschar   *name;            /* journal file name */
+  uschar   *filename;        /* buffer's file name when the journal began */
+  uschar   *batch;           /* records not yet written */
+  linestr **dirty;           /* lines whose text has changed, in order */
+  int      *hash;            /* hash of the dirty lines */
+  linestr  *cacheline;       /* a line whose index is known */
+  stampstr  stamp;           /* the base file's identification */
+  size_t    batchlen;        /* bytes in the batch */
+  size_t    batchmax;        /* size of the batch buffer */
+  size_t    size;            /* bytes written to the file */
+  size_t    checksize;       /* size at which to write a checkpoint */
+  int       cacheindex;      /* index of cacheline */
+  int       dirtycount;      /* used entries in the dirty vector */
+  int       dirtylive;       /* entries that are not NULL */
+  int       dirtymax;        /* size of the dirty vector */
+  int       savepid;         /* save that will provide the base, or 0 */
+  BOOL      stamped;         /* the base is the file identified by stamp */
+} journalstr;
+
+
 /* Buffer */
 
 typedef struct buffer {
   struct buffer *next;       /* next buffer block */
+  struct buffer *hashnext;   /* next buffer with the same hash value */
 
   linestr *bottom;           /* last line in buffer */
   linestr *current;          /* current line in buffer */
@@ -65,7 +147,13 @@ typedef struct buffer {
   linestr *top;              /* first line in buffer */
 
   backstr *backlist;         /* vector of saved positions */
+  undostep *undo;            /* newest undo step */
+  undostep *undo_oldest;     /* oldest undo step */
+  undostep *redo;            /* newest redo step */
+  size_t undosize;           /* memory held by undo steps */
   size_t binoffset;          /* offset for reading file in binary */
+  FILE *loadfid;             /* file still being read, or NULL */
+  journalstr *journal;       /* crash-recovery journal, or NULL */
 
   usint backtop;             /* top of list */
   usint backnext;            /* position in list */
@@ -86,12 +174,23 @@ typedef struct buffer {
   uschar *filename;          /* real name */
 
   CBOOL changed;             /* buffer edited */
+  CBOOL nojournal;           /* journal could not be started */
   CBOOL noprompt;            /* no prompting wanted */
   CBOOL readonly;            /* readonly flag */
   CBOOL saved;               /* saved to "own" file */
 } bufferstr;
 
 
+/* Save in progress in the background */
+
+typedef struct savestr {
+  struct savestr *next;
+  bufferstr *buffer;         /* buffer to mark changed if it fails, or NULL */
+  uschar *name;              /* file name for messages */
+  int pid;                   /* process that is writing */
+} savestr;
+
+
 
 /* === Control blocks for command processing === */
 
@@ -118,8 +217,8 @@ typedef struct qsstr {
   uschar type;                 /* cb_qstype */
   uschar count;                /* count qualifier */
   short int flags;             /* see below */
-  short int windowleft;        /* window values */
-  short int windowright;
+  int windowleft;              /* window values */
+  int windowright;
   short int length;            /* length of original string */
   pcre2_code *cre;             /* pointer to compiled regex */
   uschar *hexed;               /* hexed chars for non-R */
@@ -142,8 +241,8 @@ typedef struct sestr {
   uschar type;               /* cb_setype */
   uschar count;              /* count qualifier */
   unsigned short int flags;  /* see below */
-  short int windowleft;      /* window values */
-  short int windowright;
+  int windowleft;            /* window values */
+  int windowright;
   qseptr left;               /* left subtree */
   qseptr right;              /* right subtree */
 } sestr;
@@ -152,7 +251,7 @@ typedef struct sestr {
 /* Default window values */
 
 #define qse_defaultwindowleft   0
-#define qse_defaultwindowright  0x7fff
+#define qse_defaultwindowright  BIGNUMBER
 
 /* Qualifier flags; 16-bit field */
 
@@ -224,6 +323,10 @@ typedef struct cmd {
   uschar ptype2;            /* prompt type for arg2 */
   uschar arg1type;          /* type of arg1 */
   uschar arg2type;          /* type of arg2 */
+  uschar xflags;            /* execution flags, set when compiled */
+  usint  serial;            /* unique compilation number */
+  usint  bindgen;           /* procedure table generation for a bound call */
+  int  (*proc)(struct cmd *);  /* execution function, set when compiled */
   struct cmd *next;         /* next cmd on chain */
   usint  count;             /* repeat count */
   cmdarg arg1;              /* 1st argument */
@@ -239,6 +342,14 @@ typedef struct cmd {
 #define  cmdf_arg2F  8  /* arg2 is ptr to control block */
 #define  cmdf_group 16  /* this is cmd group */
 
+/* Execution flag values; these cache per-command table lookups so that
+cmd_obeyline() need not consult the tables for each command obeyed. */
+
+#define  cmdx_readonly  1  /* permitted in readonly mode */
+#define  cmdx_passive   2  /* neither changes the buffer nor moves */
+#define  cmdx_once      4  /* handles its own count (single-char command) */
+#define  cmdx_cacheable 8  /* effects can be saved in an init file cache */
+
 
 /* Procedure structure */
 
@@ -267,5 +378,24 @@ typedef struct filewritten {
   uschar *name;
 } filewritstr;
 
+/* Counts of work done in places where time is likely to go, for SHOW STATS
+and the -stats command line option. They are simple increments, so they are
+always kept. */
+
+typedef struct {
+  unsigned long int commands;      /* commands obeyed */
+  unsigned long int se_lines;      /* lines tested by search expressions */
+  unsigned long int re_compiles;   /* PCRE2 compiles */
+  unsigned long int re_matches;    /* PCRE2 match calls */
+  unsigned long int store_gets;    /* store_get() calls */
+  unsigned long int store_getwalk; /* free queue blocks passed by store_get() */
+  unsigned long int store_frees;   /* store_free() calls */
+  unsigned long int store_freewalk;/* free queue blocks passed by store_free() */
+  unsigned long int file_read;     /* bytes read from files */
+  unsigned long int file_written;  /* bytes written to files */
+  unsigned long int screen_lines;  /* screen lines drawn */
+  unsigned long int screen_bytes;  /* bytes written to the terminal */
+  time_t start;                    /* when NE started */
+} statsstr;
 
 /* End of structs.h */
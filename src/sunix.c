@@ -2,10 +2,10 @@
 *       The E text editor - 3rd incarnation      *
 *************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2025 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: March 2025 */
+/* This file last modified: October 2026 */
 
 
 /* This file contains screen-handling code, originally for use with termcap
@@ -149,6 +149,7 @@ sunix_flush(void)
 if (outbuffptr > 0)
   {
   if (write(ioctl_fd, out_buffer, outbuffptr)){};  /* Fudge avoid warning */
+  main_stats.screen_bytes += outbuffptr;
   outbuffptr = 0;
   }
 }
@@ -222,7 +223,7 @@ return 0;                    /* Keep compiler happy */
 /* The actual getchar function */
 
 static int
-sunix_getchar(void)
+sunix_rawchar(void)
 {
 int c;
 BOOL withkey_slept;
@@ -421,6 +422,43 @@ return getchar();
 }
 
 
+/* When a trace is being written, it records the bytes of each keystroke, so
+that the session can be replayed. */
+
+static int
+sunix_getchar(void)
+{
+int c = sunix_rawchar();
+if (trace_fid != NULL && c != EOF) trace_input(c);
+return c;
+}
+
+
+
+/*************************************************
+*         Test for a waiting keystroke           *
+*************************************************/
+
+/* This is used while work is being done in the background. Keystrokes are
+read from stdin unbuffered, so polling it is sufficient. Simulated keystrokes
+are always waiting, so when they are in use, background work is done only when
+something needs it.
+
+Argument:  milliseconds to wait for a keystroke
+Returns:   TRUE if there is a keystroke to be read
+*/
+
+static BOOL
+sunix_keywaiting(int timeout)
+{
+struct pollfd pfd;
+if (kbbackptr > 0 || withkey_fid != NULL) return TRUE;
+pfd.fd = fileno(stdin);                         /* LCOV_EXCL_LINE */
+pfd.events = POLLIN;                            /* LCOV_EXCL_LINE */
+return poll(&pfd, 1, timeout) != 0;             /* LCOV_EXCL_LINE */
+}
+
+
 
 /*************************************************
 *      Get keystroke and convert to standard     *
@@ -440,13 +478,12 @@ Returns:   keystroke value
 */
 
 static int
-sunix_nextchar(int *type)
+sunix_getkey(int *type)
 {
 int scount, kbptr, c, k;
 uschar *sp;
 uschar kbbuff[20];
 
-sunix_flush();       /* Deliver buffered output */
 *type = ktype_data;  /* Default to data */
 
 /* Get next key */
@@ -614,6 +651,39 @@ return c;
 }
 
 
+/* Buffered output must be delivered before waiting for the next keystroke.
+When a trace is being written, that is the end of the previous keystroke's
+record. */
+
+static void
+sunix_deliver(void)
+{
+if (trace_fid == NULL) sunix_flush(); else
+  {
+  (void)trace_phase(trace_flush);
+  sunix_flush();
+  trace_end();
+  }
+}
+
+/* Deliver output, then get the next keystroke, starting a new trace record if
+required.
+
+Argument:  where to return the keystroke type - data or function
+Returns:   keystroke value
+*/
+
+static int
+sunix_nextchar(int *type)
+{
+int key;
+sunix_deliver();
+key = sunix_getkey(type);
+if (trace_fid != NULL) trace_key(*type, key);
+return key;
+}
+
+
 
 /*************************************************
 *       Get keystroke for command line           *
@@ -631,7 +701,7 @@ int
 sys_cmdkeystroke(int *type)
 {
 int key = sunix_nextchar(type);
-if (key == oldtermparm.c_cc[VINTR]) main_escape_pressed = TRUE;
+if (key == oldtermparm.c_cc[VINTR]) main_escape_pressed = main_cicheck = TRUE;
 if (*type == ktype_function && key >= 127)
   key = (key >= Pkey_f0)? s_f_umax + key - Pkey_f0 : Pkeytable[key - 127];
 return key;
@@ -656,6 +726,7 @@ if (outbuffptr > outbuffsize - 2)
   {
   /* LCOV_EXCL_START */
   if (write(ioctl_fd, out_buffer, outbuffptr)){};  /* Fudge avoid warning */
+  main_stats.screen_bytes += outbuffptr;
   outbuffptr = 0;
   /* LCOV_EXCL_STOP */
   }
@@ -730,7 +801,7 @@ if (r != sunix_setrendition)
 static void
 sunix_putc(int c)
 {
-if (c > 0xffff || (ch_displayable[c/8] & (1<<(c%8))) != 0) c = screen_subchar;
+if (ch_width(c) == 0) c = screen_subchar;
 if (c < 128)
   {
   my_putc(c);
@@ -838,7 +909,7 @@ else
 void
 sys_mouse(BOOL enable)
 {
-if (tt_special != tt_special_xterm) return;
+if (tt_special != tt_special_xterm || arg_headless_name != NULL) return;
 if (enable && mouse_enable && write(ioctl_fd, "\x1b[?1000h", 8));
   else if (write(ioctl_fd, "\x1b[?1000l", 8)){};
 }
@@ -926,7 +997,7 @@ terminal if necessary. */
 void
 sys_crashposition(void)
 {
-if (main_screenOK)
+if (main_screenOK && arg_headless_name == NULL)
   {
   /* LCOV_EXCL_START - no disasters in the test suite */
   sunix_rendition(s_r_normal);
@@ -966,6 +1037,16 @@ sys_w_vscroll = sunix_vscroll;
 sys_setupterminal = setupterminal;
 sys_resetterminal = resetterminal;
 
+/* For a headless run, the screen is kept in memory and the terminal is left
+alone. The screen is treated as UTF-8. */
+
+if (arg_headless_name != NULL)
+  {
+  headless_select(arg_headless_name);
+  sys_setupterminal = sys_resetterminal = NULL;
+  main_utf8terminal = TRUE;
+  }
+
 /* If there's an input file, open it before initializing the screen so that if
 there's a problem, the screen is not disturbed. */
 
@@ -1002,11 +1083,20 @@ if (tt_special == tt_special_xterm)
   key_specialmap[2] = 0x0000009Fu;  /* ctrl tab, delete, ctrl arrows */
   }
 
+/* Keystrokes are read unbuffered, so that sunix_keywaiting() can tell when
+there are none. */
+
+setvbuf(stdin, NULL, _IONBF, 0);
+
 /* Read and save original terminal state before seting up. */
 
-tcgetattr(ioctl_fd, &oldtermparm);
+if (arg_headless_name == NULL)
+  {
+  tcgetattr(ioctl_fd, &oldtermparm);
+  setupterminal();
+  }
+else oldtermparm.c_cc[VINTR] = 3;   /* As on a typical terminal */
 tc_int_ch = oldtermparm.c_cc[VINTR];
-setupterminal();
 
 /* If we are in an xterm, see whether it is UTF-8 enabled. The only way I've
 found of doing this is to write two bytes which independently are two 8859
@@ -1016,7 +1106,7 @@ and 0xa1. As a UTF-8 sequence, these two encode 0xe1. The control sequence to
 read the cursor position is ESC [ 6 n where ESC [ is the two-byte encoding of
 CSI. */
 
-if (tt_special == tt_special_xterm)
+if (tt_special == tt_special_xterm && arg_headless_name == NULL)
   {
   char buff[16];
   outTCstring(tc_s_cl, 0);                  /* clear the screen */
@@ -1160,8 +1250,31 @@ if (init_init(fid, fromname, toname))
 
   while (!main_done)
     {
-    int type;
-    int key = sunix_nextchar(&type);
+    int type, key;
+
+    /* Show the effect of the previous keystroke before doing anything that
+    might wait for the next one. */
+
+    sunix_deliver();
+    if (arg_headless_name != NULL) headless_keywait();
+
+    /* While any file is still being read, read more of it until there is a
+    keystroke. While any save is in progress, check for its completion every
+    tenth of a second. */
+
+    while ((main_loading || main_saving) &&
+           !sunix_keywaiting(main_loading? 0 : 100))
+      {
+      if (main_saving) file_savecheck(FALSE);
+      if (main_loading) file_loadnext();
+      }
+
+    /* The crash-recovery journals are written when no keystroke has arrived
+    for a while, or before each simulated keystroke, for testing. */
+
+    if (withkey_fid != NULL || !sunix_keywaiting(JOURNAL_IDLE))
+      journal_flush();
+    key = sunix_nextchar(&type);
 
     /* Wipe out error status at each interaction. */
 
@@ -1186,8 +1299,10 @@ if (init_init(fid, fromname, toname))
       /* LCOV_EXCL_STOP */
       }
 
-    /* Handle the keystroke */
+    /* Handle the keystroke. Each one is a separate step for undoing, except
+    that consecutive data keystrokes on one line are coalesced. */
 
+    undo_begin(type != ktype_function);
     if (type == ktype_function)
       {
       if (key < 32) key_handle_function(key);
@@ -1200,9 +1315,22 @@ if (init_init(fid, fromname, toname))
 
 /* End of screen editing run */
 
-sunix_rendition(s_r_normal);
-resetterminal();
-close(ioctl_fd);
+if (trace_fid != NULL) trace_end();
+if (arg_headless_name != NULL) headless_end(); else
+  {
+  sunix_rendition(s_r_normal);
+  resetterminal();
+  close(ioctl_fd);
+  }
+
+/* Wait for any saves that are still in progress; failures are reported on the
+normal terminal. */
+
+if (main_saving)
+  {
+  main_screenOK = FALSE;
+  file_savecheck(TRUE);
+  }
 }
 
 /* End of sunix.c */
@@ -2,10 +2,10 @@
 *       The E text editor - 3rd incarnation      *
 *************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2023 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: February 2023 */
+/* This file last modified: October 2026 */
 
 
 /* This file contains the system-specific routines for Unix-like environments,
@@ -18,6 +18,7 @@ with the exception of the window-specific code, which lives in its own modules.
 
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/time.h>
 #include <fcntl.h>
 #include <dirent.h>
 
@@ -622,11 +623,494 @@ return TRUE;
 
 
 /*************************************************
-*            Check terminal type                 *
+*           Find the name of a cache file        *
+*************************************************/
+
+/* Information that is slow to compute at startup can be cached in files in a
+directory that is named by the NECACHE environment variable, defaulting to
+~/.cache/ne. If NECACHE is set empty, there is no caching. The directory is
+created if necessary.
+
+Arguments:
+  buffer    where to put the name
+  name      the name of the file within the directory
+
+Returns:    TRUE if the name has been set up; FALSE if there is no caching
+*/
+
+BOOL
+sys_cachename(uschar *buffer, uschar *name)
+{
+uschar *dir = US getenv("NECACHE");
+size_t len;
+
+if (dir == NULL)
+  {
+  uschar *home = US getenv("HOME");
+  if (home == NULL || home[0] == 0 ||
+      Ustrlen(home) + Ustrlen(name) + 12 > FNAME_BUFFER_SIZE) return FALSE;
+  sprintf(CS buffer, "%s/.cache", home);
+  (void)mkdir(CS buffer, 0700);
+  Ustrcat(buffer, "/ne");
+  }
+else
+  {
+  if (dir[0] == 0 || Ustrlen(dir) + Ustrlen(name) + 2 > FNAME_BUFFER_SIZE)
+    return FALSE;
+  Ustrcpy(buffer, dir);
+  }
+
+(void)mkdir(CS buffer, 0700);
+len = Ustrlen(buffer);
+sprintf(CS buffer + len, "/%s", name);
+
+/* Characters that cannot be in a file name are changed. */
+
+for (uschar *p = buffer + len + 1; *p != 0; p++) if (*p == '/') *p = '_';
+return TRUE;
+}
+
+
+
+/*************************************************
+*            Write a cache file                  *
+*************************************************/
+
+/* A cache file is written under a temporary name and then renamed, so that
+another NE never sees a partial file. Numbers are written in the machine's own
+format, because a cache is not moved between machines. A string is written as
+its length followed by its bytes; a NULL string has length -1. A cache file
+starts with a string that identifies its type, followed by NE's version. */
+
+static uschar cache_tempname[FNAME_BUFFER_SIZE];
+
+void
+sys_cacheputnumber(FILE *f, long int n)
+{
+fwrite(&n, sizeof(n), 1, f);
+}
+
+void
+sys_cacheputstring(FILE *f, uschar *s)
+{
+long int len = (s == NULL)? -1 : (long int)Ustrlen(s);
+sys_cacheputnumber(f, len);
+if (len > 0) fwrite(s, 1, len, f);
+}
+
+
+/* Start writing a cache file.
+
+Arguments:
+  name      the name of the cache file
+  magic     the identifying string
+
+Returns:    the FILE, or NULL if it could not be opened
+*/
+
+FILE *
+sys_cachewritestart(uschar *name, uschar *magic)
+{
+FILE *f;
+if (Ustrlen(name) + 16 > FNAME_BUFFER_SIZE) return NULL;
+sprintf(CS cache_tempname, "%s.%d", name, (int)getpid());
+f = Ufopen(cache_tempname, "wb");
+if (f == NULL) return NULL;
+sys_cacheputstring(f, magic);
+sys_cacheputstring(f, version_string);
+return f;
+}
+
+
+/* Finish writing a cache file. Any failure just means there is no cache.
+
+Arguments:
+  f         the FILE
+  name      the name of the cache file
+
+Returns:    nothing
+*/
+
+void
+sys_cachewriteend(FILE *f, uschar *name)
+{
+BOOL failed = ferror(f) != 0;
+if (fclose(f) != 0) failed = TRUE;
+if (failed || rename(CS cache_tempname, CS name) != 0)
+  (void)unlink(CS cache_tempname);
+}
+
+
+
+/*************************************************
+*             Read a cache file                  *
+*************************************************/
+
+/* The items are taken in turn from a buffer that holds the whole file. If
+there is not enough data, the pointer is set to NULL, so that a number of items
+can be read before checking.
+
+Arguments:
+  aptr      points to the pointer to the next item
+  end       the end of the data
+  alen      where to return the length of a string, or NULL
+
+Returns:    the number or the string; a string is not zero-terminated, and is
+              NULL if it was written as NULL
+*/
+
+long int
+sys_cachenumber(uschar **aptr, uschar *end)
+{
+long int n = 0;
+if (*aptr == NULL || *aptr + sizeof(n) > end) *aptr = NULL; else
+  {
+  memcpy(&n, *aptr, sizeof(n));
+  *aptr += sizeof(n);
+  }
+return n;
+}
+
+uschar *
+sys_cachestring(uschar **aptr, uschar *end, long int *alen)
+{
+uschar *s;
+long int len = sys_cachenumber(aptr, end);
+if (*aptr == NULL || len < 0) return NULL;
+if (*aptr + len > end)
+  {
+  *aptr = NULL;
+  return NULL;
+  }
+s = *aptr;
+*aptr += len;
+if (alen != NULL) *alen = len;
+return s;
+}
+
+/* Test a string item against an expected value. */
+
+BOOL
+sys_cachematch(uschar **aptr, uschar *end, uschar *expect)
+{
+long int len;
+uschar *s = sys_cachestring(aptr, end, &len);
+return *aptr != NULL && s != NULL && len == (long int)Ustrlen(expect) &&
+  Ustrncmp(s, expect, len) == 0;
+}
+
+
+/* Read a whole cache file with a single read, and check its identification.
+The caller must free the buffer when it has finished with the data.
+
+Arguments:
+  name      the name of the cache file
+  magic     the identifying string
+  aptr      where to return the pointer to the first item
+  aend      where to return the pointer to the end of the data
+
+Returns:    the buffer, or NULL if the file could not be read or is not for
+              this version of NE
+*/
+
+uschar *
+sys_cacheread(uschar *name, uschar *magic, uschar **aptr, uschar **aend)
+{
+struct stat statbuf;
+uschar *buffer, *p;
+int fd = open(CS name, O_RDONLY);
+
+if (fd < 0) return NULL;
+if (fstat(fd, &statbuf) != 0 || statbuf.st_size < 16)
+  {
+  close(fd);
+  return NULL;
+  }
+
+buffer = store_Xget(statbuf.st_size);
+if (read(fd, buffer, statbuf.st_size) != statbuf.st_size)
+  {
+  close(fd);
+  store_free(buffer);
+  return NULL;
+  }
+close(fd);
+
+p = buffer;
+*aend = buffer + statbuf.st_size;
+if (!sys_cachematch(&p, *aend, magic) ||
+    !sys_cachematch(&p, *aend, version_string))
+  {
+  store_free(buffer);
+  return NULL;
+  }
+
+*aptr = p;
+return buffer;
+}
+
+
+
+#ifndef HAVE_TERMCAP
+/*************************************************
+*        Cache of terminal capabilities          *
+*************************************************/
+
+/* Reading the terminfo entry and building the tables of key sequences is done
+at every start of a screen run. The results are saved in a cache file for each
+terminal type, and used instead for as long as the terminfo file that they came
+from is unchanged. The cache records the file's name, size, and modification
+time; the file is found by searching the standard terminfo directories in the
+order that the curses library uses. If no file is found (for example, when the
+entries are in a hashed database), there is no caching. The screen size is not
+cached, except for the value in the terminfo entry, which is used only when the
+size cannot be obtained in other ways. There is no cache when termcap is used.
+*/
+
+#define TC_CACHE_MAGIC  "NE terminal cache 1"
+
+static uschar **tc_cached_strings[] = {
+  &tc_s_al, &tc_s_bc, &tc_s_ce, &tc_s_cl, &tc_s_cm, &tc_s_cs, &tc_s_dc,
+  &tc_s_dl, &tc_s_ic, &tc_s_ip, &tc_s_ke, &tc_s_ks, &tc_s_pc, &tc_s_se,
+  &tc_s_sf, &tc_s_so, &tc_s_sr, &tc_s_te, &tc_s_ti, &tc_s_up };
+
+#define tc_cached_count (int)(sizeof(tc_cached_strings)/sizeof(uschar **))
+
+static uschar tc_cache_name[FNAME_BUFFER_SIZE];
+static BOOL   tc_cache_ok = FALSE;  /* tc_cache_name is set up */
+
+
+/* Look for the terminfo file for the terminal in one directory, using the
+first letter of the name, or its value in hexadecimal, as a subdirectory.
+
+Arguments:
+  dir       the directory name
+  len       its length
+  buffer    where to put the file name
+  statbuf   where to put the file's data
+
+Returns:    TRUE if found
+*/
+
+static BOOL
+terminfo_lookin(uschar *dir, size_t len, uschar *buffer, struct stat *statbuf)
+{
+if (len + Ustrlen(term_name) + 8 > FNAME_BUFFER_SIZE) return FALSE;
+sprintf(CS buffer, "%.*s/%c/%s", (int)len, dir, term_name[0], term_name);
+if (Ustat(buffer, statbuf) == 0) return TRUE;
+sprintf(CS buffer, "%.*s/%02x/%s", (int)len, dir, term_name[0], term_name);
+return Ustat(buffer, statbuf) == 0;
+}
+
+static BOOL
+terminfo_lookinsystem(uschar *buffer, struct stat *statbuf)
+{
+static const char *sysdirs[] = { "/etc/terminfo", "/lib/terminfo",
+  "/usr/share/terminfo", "/usr/lib/terminfo", NULL };
+for (const char **d = sysdirs; *d != NULL; d++)
+  if (terminfo_lookin(US *d, strlen(*d), buffer, statbuf)) return TRUE;
+return FALSE;
+}
+
+
+/* Find the terminfo file for the terminal, searching in the same order as
+curses: $TERMINFO, ~/.terminfo, then the directories in $TERMINFO_DIRS, where
+an empty item stands for the system's directories, which are otherwise
+searched last.
+
+Arguments:
+  buffer    where to put the name
+  statbuf   where to put the file's data
+
+Returns:    TRUE if found
+*/
+
+static BOOL
+terminfo_file(uschar *buffer, struct stat *statbuf)
+{
+uschar *env = US getenv("TERMINFO");
+
+if (env != NULL && env[0] != 0 &&
+    terminfo_lookin(env, Ustrlen(env), buffer, statbuf)) return TRUE;
+
+env = US getenv("HOME");
+if (env != NULL && env[0] != 0 && Ustrlen(env) + 12 < FNAME_BUFFER_SIZE)
+  {
+  uschar home[FNAME_BUFFER_SIZE];
+  sprintf(CS home, "%s/.terminfo", env);
+  if (terminfo_lookin(home, Ustrlen(home), buffer, statbuf)) return TRUE;
+  }
+
+env = US getenv("TERMINFO_DIRS");
+if (env == NULL || env[0] == 0) return terminfo_lookinsystem(buffer, statbuf);
+
+for (;;)
+  {
+  uschar *colon = Ustrchr(env, ':');
+  size_t len = (colon == NULL)? Ustrlen(env) : (size_t)(colon - env);
+  if (len == 0)
+    {
+    if (terminfo_lookinsystem(buffer, statbuf)) return TRUE;
+    }
+  else if (terminfo_lookin(env, len, buffer, statbuf)) return TRUE;
+  if (colon == NULL) break;
+  env = colon + 1;
+  }
+
+return FALSE;
+}
+
+
+/* Load the cache, if it is present and valid.
+
+Arguments:  none
+Returns:    TRUE if the data has been loaded
+*/
+
+static BOOL
+tc_cacheload(void)
+{
+struct stat statbuf;
+uschar tifile[FNAME_BUFFER_SIZE];
+uschar *buffer, *p, *end, *s, *entry;
+long int len;
+BOOL yield = FALSE;
+
+if (term_name == NULL || term_name[0] == 0 ||
+    Ustrlen(term_name) + 8 > FNAME_BUFFER_SIZE) return FALSE;
+sprintf(CS tifile, "term-%s", term_name);
+tc_cache_ok = sys_cachename(tc_cache_name, tifile);
+if (!tc_cache_ok) return FALSE;
+
+/* Without a terminfo file, there is nothing to check a cache against. */
+
+if (!terminfo_file(tifile, &statbuf))
+  {
+  tc_cache_ok = FALSE;
+  return FALSE;
+  }
+
+buffer = sys_cacheread(tc_cache_name, US TC_CACHE_MAGIC, &p, &end);
+if (buffer == NULL) return FALSE;
+
+/* Check that the cache is for this terminal and the same terminfo file, then
+read the sizes from the terminfo entry and the other capabilities. */
+
+if (!sys_cachematch(&p, end, term_name) || !sys_cachematch(&p, end, tifile) ||
+    sys_cachenumber(&p, end) != (long int)statbuf.st_size ||
+    sys_cachenumber(&p, end) != (long int)statbuf.st_mtime ||
+    p == NULL) goto END;
+
+tc_n_li = sys_cachenumber(&p, end);
+tc_n_co = sys_cachenumber(&p, end);
+NoZero = sys_cachenumber(&p, end);
+tc_f_am = sys_cachenumber(&p, end);
+
+for (int i = 0; i < tc_cached_count; i++)
+  {
+  s = sys_cachestring(&p, end, &len);
+  if (p == NULL) goto END;
+  if (s != NULL)
+    {
+    uschar *copy = store_Xget(len + 1);
+    memcpy(copy, s, len);
+    copy[len] = 0;
+    s = copy;
+    }
+  *(tc_cached_strings[i]) = s;
+  }
+
+/* The key tables. The strings table starts with a count, followed by that
+many entries, each of which is a length byte that includes itself, a
+zero-terminated escape sequence, and the key value. The keyboard reader trusts
+these, so check that every entry is complete before accepting them. */
+
+s = sys_cachestring(&p, end, &len);
+if (p == NULL || s == NULL || len < 1 || len > tc_keylistsize) goto END;
+entry = s + 1;
+for (int i = 0; i < s[0]; i++)
+  {
+  if (entry >= s + len || entry[0] < 3 || entry[0] > s + len - entry ||
+      memchr(entry + 1, 0, entry[0] - 2) == NULL) goto END;
+  entry += entry[0];
+  }
+tc_k_strings = store_Xget(tc_keylistsize);
+memcpy(tc_k_strings, s, len);
+
+/* Each trigger value must be 255 (nothing special), 254 (the start of a
+sequence in the strings table), or a key value that the keyboard reader can
+translate. */
+
+s = sys_cachestring(&p, end, &len);
+if (p == NULL || s == NULL || len != 128) goto END;
+for (int i = 0; i < 128; i++)
+  {
+  int k = s[i];
+  if (k != 254 && k != 255 && k > Pkey_mscr_up &&
+      (k < Pkey_f0 || k > Pkey_f0 + max_fkey)) goto END;
+  }
+tc_k_trigger = store_Xget(128);
+memcpy(tc_k_trigger, s, 128);
+yield = TRUE;
+
+END:
+if (!yield && tc_k_strings != NULL)
+  {
+  store_free(tc_k_strings);
+  tc_k_strings = NULL;
+  }
+store_free(buffer);
+return yield;
+}
+
+
+/* Save the data in the cache. The sizes are those from the terminfo entry.
+
+Arguments:
+  keylen    the length of the key strings table
+  li        the number of lines in the terminfo entry
+  co        the number of columns in the terminfo entry
+
+Returns:    nothing
+*/
+
+static void
+tc_cachesave(int keylen, int li, int co)
+{
+struct stat statbuf;
+uschar tifile[FNAME_BUFFER_SIZE];
+FILE *f;
+
+if (!tc_cache_ok || !terminfo_file(tifile, &statbuf)) return;
+f = sys_cachewritestart(tc_cache_name, US TC_CACHE_MAGIC);
+if (f == NULL) return;
+
+sys_cacheputstring(f, term_name);
+sys_cacheputstring(f, tifile);
+sys_cacheputnumber(f, (long int)statbuf.st_size);
+sys_cacheputnumber(f, (long int)statbuf.st_mtime);
+sys_cacheputnumber(f, li);
+sys_cacheputnumber(f, co);
+sys_cacheputnumber(f, NoZero);
+sys_cacheputnumber(f, tc_f_am);
+for (int i = 0; i < tc_cached_count; i++)
+  sys_cacheputstring(f, *(tc_cached_strings[i]));
+sys_cacheputnumber(f, keylen);
+fwrite(tc_k_strings, 1, keylen, f);
+sys_cacheputnumber(f, 128);
+fwrite(tc_k_trigger, 1, 128, f);
+sys_cachewriteend(f, tc_cache_name);
+}
+#endif  /* HAVE_TERMCAP */
+
+
+
+/*************************************************
+*           Read terminal capabilities           *
 *************************************************/
 
 /* Search the termcap or terminfo database to determine the capability of the
-terminal. Nowadays only two kinds of terminal are recognized.
+terminal, and build the tables for recognizing special keys.
 
 Arguments:  none
 
@@ -635,48 +1119,33 @@ Returns:    term_screen: terminal can do screen editing
 */
 
 static int
-CheckTerminal(void)
+ReadTerminal(void)
 {
 uschar *p;
 uschar *keyptr;
 int erret;
 int keycount = 0;
-struct winsize parm;
-
-/* Set up a file descriptor to the terminal for use in various ioctl calls. */
-
-ioctl_fd = open("/dev/tty", O_RDWR);
 
 #ifdef HAVE_TERMCAP
 if (termcap_buf == NULL) termcap_buf = (uschar *)store_Xget(1024);
 if (tgetent(termcap_buf, term_name) != 1) return term_other;
 #else  /* terminfo */
+use_env(FALSE);   /* The size is checked in CheckTerminal() */
 if (setupterm(CS term_name, ioctl_fd, &erret) != OK || erret != 1)
   return term_other;
 #endif
 
-/* First, investigate terminal size. See if we can get the values from an ioctl
-call. If not, we take them from termcap/info. */
-
-tc_n_li = 0;
-tc_n_co = 0;
-
-if (ioctl(ioctl_fd, TIOCGWINSZ, &parm) == 0)
-  {
-  if (parm.ws_row != 0) tc_n_li = parm.ws_row;
-  if (parm.ws_col != 0) tc_n_co = parm.ws_col;
-  }
+/* Take the screen size from termcap/info, for use if it cannot be found in
+other ways. */
 
 #ifdef HAVE_TERMCAP
-if (tc_n_li == 0) tc_n_li = tgetnum("li");  /* number of lines on screen */
-if (tc_n_co == 0) tc_n_co = tgetnum("co");  /* number of columns on screen */
+tc_n_li = tgetnum("li");  /* number of lines on screen */
+tc_n_co = tgetnum("co");  /* number of columns on screen */
 #else
-if (tc_n_li == 0) tc_n_li = tigetnum("lines"); /* number of lines on screen */
-if (tc_n_co == 0) tc_n_co = tigetnum("cols");  /* number of columns on screen */
+tc_n_li = tigetnum("lines"); /* number of lines on screen */
+tc_n_co = tigetnum("cols");  /* number of columns on screen */
 #endif
 
-if (tc_n_li <= 0 || tc_n_co <= 0) return term_other;
-
 /* Terminal must be capable of moving the cursor to arbitrary positions */
 
 if ((p = tc_s_cm = my_tgetstr(US TCI_CM)) == 0) return term_other;
@@ -828,18 +1297,10 @@ if (!tgetkeystr(US TCI_KR, &keycount, &keyptr, Pkey_right)) return term_other;
 (void)tgetkeystr(US TCI_FJ, &keycount, &keyptr, Pkey_f0+29);
 (void)tgetkeystr(US TCI_FK, &keycount, &keyptr, Pkey_f0+30);
 
-/* Some terminals have more facilities than can be described by termcap/info.
-Knowledge of some of them is screwed in to this code. If termcap/info ever
-expands, this can be generalized. There was a lot of history here, but I've now
-cut out all the specials except xterm. */
+/* Add the sequences for xterms that termcap/info does not describe. */
 
-tt_special = tt_special_none;
-if (Ustrncmp(term_name, "xterm",5) == 0)
-  {
-  tt_special = tt_special_xterm;
-  if (tc_s_ti != NULL) main_nlexit = FALSE;  /* No NL needed if scrn managed */
+if (tt_special == tt_special_xterm)
   addkeystr_list(xterm_escapes, &keycount, &keyptr);
-  }
 
 /* There are certain escape sequences that are built into NE. We put them last
 so that they are only matched if those obtained from termcap/terminfo do not
@@ -858,6 +1319,82 @@ addkeystr_list(wide_escapes, &keycount, &keyptr);
 
 tc_k_strings[0] = keycount;
 
+/* Save the results for next time. */
+
+#ifndef HAVE_TERMCAP
+tc_cachesave(keyptr - tc_k_strings, tc_n_li, tc_n_co);
+#endif
+
+return term_screen;
+}
+
+
+
+/*************************************************
+*            Check terminal type                 *
+*************************************************/
+
+/* Find the capabilities of the terminal, from the cache if possible, and then
+find its size. Nowadays only two kinds of terminal are recognized.
+
+Arguments:  none
+
+Returns:    term_screen: terminal can do screen editing
+            term_other:  terminal can't do screen editing
+*/
+
+static int
+CheckTerminal(void)
+{
+int keycount;
+uschar *env;
+struct winsize parm;
+
+/* Set up a file descriptor to the terminal for use in various ioctl calls.
+There is none for a headless run, which gets its screen size from the LINES and
+COLUMNS environment variables or the terminal description, and must not touch
+any terminal that it happens to have. */
+
+ioctl_fd = (arg_headless_name == NULL)? open("/dev/tty", O_RDWR) : -1;
+
+/* Some terminals have more facilities than can be described by termcap/info.
+Knowledge of some of them is screwed in to this code. If termcap/info ever
+expands, this can be generalized. There was a lot of history here, but I've now
+cut out all the specials except xterm. */
+
+tt_special = (term_name != NULL && Ustrncmp(term_name, "xterm", 5) == 0)?
+  tt_special_xterm : tt_special_none;
+
+#ifdef HAVE_TERMCAP
+if (ReadTerminal() != term_screen) return term_other;
+#else
+if (!tc_cacheload() && ReadTerminal() != term_screen) return term_other;
+#endif
+
+/* Find the screen size from an ioctl call if possible. Otherwise, use the
+LINES and COLUMNS environment variables, and finally the values from
+termcap/info. */
+
+if (ioctl(ioctl_fd, TIOCGWINSZ, &parm) == 0)
+  {
+  if (parm.ws_row != 0) tc_n_li = parm.ws_row;
+  if (parm.ws_col != 0) tc_n_co = parm.ws_col;
+  }
+else
+  {
+  if ((env = US getenv("LINES")) != NULL && atoi(CS env) > 0)
+    tc_n_li = atoi(CS env);
+  if ((env = US getenv("COLUMNS")) != NULL && atoi(CS env) > 0)
+    tc_n_co = atoi(CS env);
+  }
+
+if (tc_n_li <= 0 || tc_n_co <= 0) return term_other;
+
+/* Settings for xterms that do not depend on the terminfo entry. */
+
+if (tt_special == tt_special_xterm && tc_s_ti != NULL)
+  main_nlexit = FALSE;  /* No NL needed if scrn managed */
+
 /* Remove the default actions for various shift+ctrl keys that are not
 settable. This will prevent them from being displayed. */
 
@@ -928,6 +1465,33 @@ signal(SIGWINCH, sigwinch_handler);
 
 
 
+/*************************************************
+*         Handle interrupt timer signal          *
+*************************************************/
+
+/* The timer runs only while commands are being obeyed in screen mode. The
+handler is installed with SA_RESTART so that the signal does not break any
+system calls that are in progress. */
+
+static void
+sigalrm_handler(int sig)
+{
+(void)sig;
+main_cicheck = TRUE;
+}
+
+static void
+sigalrm_init(void)
+{
+struct sigaction act;
+act.sa_handler = sigalrm_handler;
+sigemptyset(&act.sa_mask);
+act.sa_flags = SA_RESTART;
+sigaction(SIGALRM, &act, NULL);
+}
+
+
+
 /* LCOV_EXCL_START */
 /*************************************************
 *          Handle (ignore) SIGHUP                *
@@ -994,10 +1558,16 @@ if (!main_screenmode) term_type = term_other; else
     screen_max_row = tc_n_li - 1;
     screen_max_col = tc_n_co - 1;
     scommon_select();                    /* connect the common screen driver */
-    signal(SIGWINCH, sigwinch_handler);
+    if (arg_headless_name == NULL) signal(SIGWINCH, sigwinch_handler);
+    sigalrm_init();
     break;
 
     default:
+    if (arg_headless_name != NULL)
+      {
+      main_screenmode = main_screenOK = FALSE;
+      error_moan(85);                    /* Hard */
+      }
     printf("This terminal (%s) cannot support screen editing in NE;\n",
       term_name);
     printf("therefore entering line mode:\n\n");
@@ -1037,7 +1607,7 @@ sys_tidy_up(void)
 {
 if (!main_screenmode) return;
 #ifndef HAVE_TERMCAP
-del_curterm(cur_term);
+if (cur_term != NULL) del_curterm(cur_term);  /* Not set up if cached */
 #endif
 }
 
@@ -1310,6 +1880,263 @@ return Ufopen(name, type);
 
 
 
+/*************************************************
+*        Generate a journal file name            *
+*************************************************/
+
+/* The crash-recovery journal for a file is kept in the same directory. Its
+name is the file's name with a dot in front and ".nej" on the end.
+
+Argument:  the file name - may begin with ~
+Returns:   the journal name, in new store
+*/
+
+uschar *
+sys_journalname(uschar *name)
+{
+uschar buff[256];
+uschar *base, *yield;
+size_t dirlen;
+
+if (name[0] == '~')
+  {
+  sort_twiddle(name, Ustrlen(name), buff);
+  name = buff;
+  }
+
+base = Ustrrchr(name, '/');
+base = (base == NULL)? name : base + 1;
+dirlen = base - name;
+yield = store_Xget(Ustrlen(name) + 6);
+memcpy(yield, name, dirlen);
+sprintf(CS yield + dirlen, ".%s.nej", base);
+return yield;
+}
+
+
+
+/*************************************************
+*         Get the identification of a file       *
+*************************************************/
+
+/* This is used to check that the file on which a journal is based has not
+changed. Only regular files are acceptable.
+
+Arguments:
+  name       file name - may begin with ~; used if f is NULL
+  f          an open file, or NULL
+  stamp      where to put the identification
+
+Returns:     TRUE if all went well
+*/
+
+BOOL
+sys_filestamp(uschar *name, FILE *f, stampstr *stamp)
+{
+struct stat statbuf;
+uschar buff[256];
+
+if (f != NULL)
+  {
+  if (fstat(fileno(f), &statbuf) != 0) return FALSE;
+  }
+else
+  {
+  if (name[0] == '~')
+    {
+    sort_twiddle(name, Ustrlen(name), buff);
+    name = buff;
+    }
+  if (Ustat(name, &statbuf) != 0) return FALSE;
+  }
+
+if (!S_ISREG(statbuf.st_mode)) return FALSE;
+stamp->size = (long)statbuf.st_size;
+stamp->mtime = (long)statbuf.st_mtime;
+stamp->inode = (long)statbuf.st_ino;
+return TRUE;
+}
+
+
+
+/*************************************************
+*        Start a background writing process      *
+*************************************************/
+
+/* This is used for saving a buffer while editing continues. The child process
+has a copy-on-write snapshot of the editor's memory, so it can write out the
+lines while the parent goes on changing them. The child must not dump buffers
+if it crashes, and it carries on if the terminal goes away or the user
+interrupts the editor.
+
+Arguments:  none
+Returns:    0 in the child, the child's process id in the parent, or -1 if
+              the process could not be created
+*/
+
+int
+sys_bgstart(void)
+{
+int pid = (int)fork();
+if (pid == 0)
+  {
+  for (int i = 0; signal_list[i] > 0; i++) signal(signal_list[i], SIG_DFL);
+  signal(SIGHUP, SIG_IGN);
+  signal(SIGINT, SIG_IGN);
+  }
+return pid;
+}
+
+
+
+/*************************************************
+*        End a background writing process        *
+*************************************************/
+
+/* The child must not flush the parent's buffered output or run any other exit
+processing.
+
+Argument:  0 for success, or an errno value
+Returns:   nothing; does not return
+*/
+
+void
+sys_bgend(int rc)
+{
+_exit(rc);
+}
+
+
+
+/*************************************************
+*      Check on a background writing process     *
+*************************************************/
+
+/*
+Arguments:
+  pid        the process id
+  wait       TRUE to wait for it to finish
+
+Returns:     -1 if it is still running, 0 if it succeeded, or an errno value
+*/
+
+int
+sys_bgcheck(int pid, BOOL wait)
+{
+int status;
+int rc = (int)waitpid((pid_t)pid, &status, wait? 0 : WNOHANG);
+if (rc == 0) return -1;
+if (rc < 0) return errno;                                /* LCOV_EXCL_LINE */
+if (WIFEXITED(status)) return WEXITSTATUS(status);
+return EINTR;                                            /* LCOV_EXCL_LINE */
+}
+
+
+
+/*************************************************
+*        Default number of batch processes       *
+*************************************************/
+
+/*
+Arguments:  none
+Returns:    the number of processors that are online
+*/
+
+int
+sys_batchcount(void)
+{
+long n = sysconf(_SC_NPROCESSORS_ONLN);
+return (n > 0)? (int)n : 1;
+}
+
+
+
+/*************************************************
+*           Test for a directory                 *
+*************************************************/
+
+/* This is used to check the -to argument in batch mode.
+
+Argument:  the name
+Returns:   TRUE if it names an existing directory
+*/
+
+BOOL
+sys_isdirectory(uschar *name)
+{
+struct stat statbuf;
+return Ustat(name, &statbuf) == 0 && S_ISDIR(statbuf.st_mode);
+}
+
+
+
+/*************************************************
+*        Start a batch worker process            *
+*************************************************/
+
+/* In batch mode each file is edited in its own process. The child's standard
+output and standard error are sent to the given file, so that everything it
+says can be shown together when it has finished. Unlike a background writing
+process, a worker keeps NE's signal handlers, so that it can be interrupted.
+
+The child's standard input is taken from /dev/null. The list of files may be
+being read from the standard input, and when a child exits, the C library may
+move the shared file offset back to where the child's copy of stdin had got to,
+undoing the parent's read-ahead, so that the parent would read names again.
+
+Argument:  the file for the child's output
+Returns:   0 in the child, the child's process id in the parent, or -1 if
+             the process could not be created
+*/
+
+int
+sys_batchstart(FILE *f)
+{
+int pid;
+fflush(stdout);
+fflush(stderr);
+pid = (int)fork();
+if (pid == 0)
+  {
+  int fd = open("/dev/null", O_RDONLY);
+  if (fd > 0)
+    {
+    (void)dup2(fd, 0);
+    (void)close(fd);
+    }
+  (void)dup2(fileno(f), 1);
+  (void)dup2(fileno(f), 2);
+  }
+return pid;
+}
+
+
+
+/*************************************************
+*       Wait for a batch worker process          *
+*************************************************/
+
+/* A worker that was killed by a signal is given a return code of 128 plus the
+signal number, as a shell would.
+
+Argument:  where to return the worker's return code
+Returns:   the worker's process id, or -1 if there are no more workers
+*/
+
+int
+sys_batchwait(int *rc)
+{
+int status;
+int pid;
+
+do pid = (int)waitpid(-1, &status, 0); while (pid < 0 && errno == EINTR);
+if (pid < 0) return -1;
+*rc = WIFEXITED(status)? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+return pid;
+}
+
+
+
 /*************************************************
 *              Check file name                   *
 *************************************************/
@@ -1388,45 +2215,23 @@ switch (key & ~(s_f_shiftbit+s_f_ctrlbit))
 *           System-specific interrupt check      *
 *************************************************/
 
-/* This is called from main_interrupted(). This in turn is called only when the
-main part of NE is in control, not during screen editing operations. We have to
-check for ^C by steam, as we are running in raw terminal mode.
-
-It turns out that the ioctl can be quite slow, so we don't actually want to do
-it for every line in, e.g., an m command. NE now maintains a count of calls to
-main_interrupted(), reset when a command line is read, and it also passes over
-the kind of processing that is taking place:
-
-  ci_move     m, f, bf, or g command
-  ci_type     t or tl command
-  ci_read     reading command line or data for i command
-  ci_cmd      about to obey a command
-  ci_delete   deleting all lines of a buffer
-  ci_scan     scanning lines (e.g. for show wordcount)
-  ci_loop     about to obey the body of a loop
-
-These are successive integer values, starting from zero. */
-
-/* This vector of masks is used to mask the counter; if the result is
-zero, the ioctl is done. Thereby we have different intervals for different
-types of activity with very little cost. The numbers are pulled out of the
-air... */
-
-static int ci_masks[] = {
-    1023,    /* ci_move - every 1024 lines*/
-    0,       /* ci_type - every time */
-    0,       /* ci_read - every time */
-    15,      /* ci_cmd  - every 16 commands */
-    127,     /* ci_delete - every 128 lines */
-    1023,    /* ci_scan - every 1024 lines */
-    15       /* ci_loop - every 16 commands */
-};
+/* This is called from main_checkinterrupt(), which in turn is called only when
+main_cicheck is set while the main part of NE is in control, not during screen
+editing operations. We have to check for ^C by steam, as we are running in raw
+terminal mode.
+
+It turns out that the ioctl can be quite slow, so we don't want to do it for
+every line in, e.g., an m command. Counting calls does not work well either,
+because the cost of a call varies so much between different kinds of
+processing. Instead, while commands are being obeyed in screen mode, a timer
+sets main_cicheck at regular intervals (see sys_citimer() below), so the
+terminal is polled at most that often, and testing the flag is all that
+happens in between. */
 
 void
-sys_checkinterrupt(int type)
+sys_checkinterrupt(void)
 {
-if (main_screenOK && !main_escape_pressed &&
-    (main_cicount & ci_masks[type]) == 0)
+if (main_screenOK && !main_escape_pressed)
   {
   int c = 0;
   ioctl(ioctl_fd, FIONREAD, &c);
@@ -1437,4 +2242,33 @@ if (main_screenOK && !main_escape_pressed &&
   }
 }
 
+
+
+/*************************************************
+*         Start or stop interrupt timer          *
+*************************************************/
+
+/* This is called from cmd_obey() when it starts and finishes obeying an
+outermost command line. In screen mode, an interval timer is run while the
+commands are obeyed; its signal handler just sets main_cicheck. The timer is
+not run at other times, in particular not while waiting for a keystroke. In
+line mode, the SIGINT handler sets the flag, so no timer is needed.
+
+Argument:  TRUE to start the timer, FALSE to stop it
+Returns:   nothing
+*/
+
+static BOOL citimer_running = FALSE;
+
+void
+sys_citimer(BOOL start)
+{
+struct itimerval it;
+if (start == citimer_running || (start && !main_screenOK)) return;
+memset(&it, 0, sizeof(it));
+if (start) it.it_value.tv_usec = it.it_interval.tv_usec = CI_INTERVAL * 1000;
+(void)setitimer(ITIMER_REAL, &it, NULL);
+citimer_running = start;
+}
+
 /* End of sysunix.c */
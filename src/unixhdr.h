@@ -2,15 +2,17 @@
 *       The E text editor - 3rd incarnation      *
 *************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2023 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: January 2023 */
+/* This file last modified: October 2026 */
 
 /* This file is specific to the support modules for Unix-like environments. */
 
 
 #include <sys/types.h>
+#include <sys/wait.h>
+#include <poll.h>
 #include <unistd.h>
 
 #if HAVE_SYS_FCNTL_H
@@ -2,13 +2,21 @@
 *       The E text editor - 3rd incarnation      *
 *************************************************/
 
-/* Copyright (c) University of Cambridge, 1991 - 2010 */
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
 
 /* Written by Philip Hazel, starting November 1991 */
-/* This file last modified: December 2010 */
+/* This file last modified: October 2026 */
 
 #include "ehdr.h"
 
+/* The SSE2 and AVX2 scanning kernels are compiled when the compiler can
+generate code for them; which one is used depends on the processor. */
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define UTF8_X86
+#include <immintrin.h>
+#endif
+
 /* The valid ranges for UTF-8 characters are:
 
 0000 0000  to  0000 007f   1 byte (ascii)
@@ -140,4 +148,477 @@ if ((int)k != i) return -(i+1);
 return i+1;
 }
 
+
+
+/*************************************************
+*          UTF-8 scanning kernels                *
+*************************************************/
+
+/* Counting the characters in a byte range, finding the byte offset of the nth
+character, and checking that text is valid UTF-8 are all done by a "scan"
+kernel. It scans forward from the start of a byte range, stopping at the start
+of the nth character or at the end of the range. In valid UTF-8, characters
+start at the bytes that are not continuation bytes (0x80-0xbf), so this amounts
+to counting those bytes. Unless the caller knows that the text is valid, the
+kernel also checks the bytes it passes, and gives up if they are not valid
+UTF-8 in the RFC 3629 sense, which is what PCRE2 checks for. The caller then
+falls back to the SKIPCHAR() macro, which has its own rules for malformed
+sequences. This is rare, and the kernel is not tried at all for a line that is
+already flagged as invalid.
+
+There is a portable kernel, and on x86 processors there are SSE2 and AVX2
+kernels that handle 16 or 32 bytes at a time. The best one the processor
+supports is chosen when a kernel is first needed.
+
+Arguments:
+  s          start of the byte range
+  len        length of the byte range
+  n          number of characters to pass
+  chars      where to return the number of characters passed
+  check      TRUE if the bytes must be checked
+
+Returns:     the byte offset where the scan stopped, or SCAN_BAD
+*/
+
+#define SCAN_BAD  (~(usint)0)  /* invalid UTF-8 found */
+#define SCAN_MIN  16           /* shorter ranges use the portable kernel */
+
+typedef usint scanfn(const uschar *, usint, usint, usint *, BOOL);
+
+static usint
+scan_portable(const uschar *s, usint len, usint n, usint *chars, BOOL check)
+{
+usint i = 0;
+usint count = 0;
+
+while (i < len && count < n)
+  {
+  int c = s[i++];
+  count++;
+  if (c < 0x80) continue;
+
+  if (!check)
+    {
+    while (i < len && (s[i] & 0xc0) == 0x80) i++;
+    continue;
+    }
+
+  /* Check a lead byte, its first continuation byte, whose range depends on
+  the lead byte, and any further continuation bytes. */
+
+  if (c < 0xc2 || c > 0xf4) return SCAN_BAD;
+  else
+    {
+    int k = utf8_table4[c & 0x3f];
+    int lo = (c == 0xe0)? 0xa0 : (c == 0xf0)? 0x90 : 0x80;
+    int hi = (c == 0xed)? 0x9f : (c == 0xf4)? 0x8f : 0xbf;
+    if (len - i < (usint)k || s[i] < lo || s[i] > hi) return SCAN_BAD;
+    for (int j = 1; j < k; j++)
+      if ((s[i+j] & 0xc0) != 0x80) return SCAN_BAD;
+    i += k;
+    }
+  }
+
+*chars = count;
+return i;
+}
+
+
+#ifdef UTF8_X86
+
+/* The vector kernels work on blocks of 16 or 32 bytes. A block function
+returns a bit map of the bytes in the block that start characters (that is,
+are not continuation bytes). When checking, it also sets a bit map of the
+bytes that are not valid in their context. For this, it needs to look at the
+three bytes before the block, which are taken to be zero for the first block.
+A continuation byte is valid only if a lead byte in one of those positions
+requires it, and not otherwise. The first continuation byte after some lead
+bytes has a restricted range, to exclude overlong sequences, surrogates, and
+values above 0x10ffff. */
+
+typedef usint blockfn(const uschar *, usint *, BOOL, BOOL);
+
+__attribute__((target("sse2"))) static inline usint
+block_sse2(const uschar *p, usint *bad, BOOL check, BOOL first)
+{
+__m128i v = _mm_loadu_si128((const __m128i *)p);
+__m128i cont = _mm_cmpeq_epi8(_mm_and_si128(v, _mm_set1_epi8((char)0xc0)),
+  _mm_set1_epi8((char)0x80));
+usint starts = ~(usint)_mm_movemask_epi8(cont) & 0xffff;
+
+*bad = 0;
+if (check)
+  {
+  __m128i p1, p2, p3, req, err, lt90, ltA0;
+
+  if (first)
+    {
+    p1 = _mm_slli_si128(v, 1);
+    p2 = _mm_slli_si128(v, 2);
+    p3 = _mm_slli_si128(v, 3);
+    }
+  else
+    {
+    p1 = _mm_loadu_si128((const __m128i *)(p - 1));
+    p2 = _mm_loadu_si128((const __m128i *)(p - 2));
+    p3 = _mm_loadu_si128((const __m128i *)(p - 3));
+    }
+
+  /* Nothing to check if this and the previous three bytes are ASCII. */
+
+  if (_mm_movemask_epi8(_mm_or_si128(v, p3)) == 0) return starts;
+
+  req = _mm_or_si128(
+    _mm_cmpeq_epi8(_mm_and_si128(p1, _mm_set1_epi8((char)0xc0)),
+      _mm_set1_epi8((char)0xc0)),
+    _mm_or_si128(
+      _mm_cmpeq_epi8(_mm_and_si128(p2, _mm_set1_epi8((char)0xe0)),
+        _mm_set1_epi8((char)0xe0)),
+      _mm_cmpeq_epi8(_mm_and_si128(p3, _mm_set1_epi8((char)0xf0)),
+        _mm_set1_epi8((char)0xf0))));
+  err = _mm_xor_si128(req, cont);
+
+  /* Bytes that never occur: 0xc0, 0xc1, and 0xf5-0xff. */
+
+  err = _mm_or_si128(err, _mm_cmpeq_epi8(
+    _mm_and_si128(v, _mm_set1_epi8((char)0xfe)), _mm_set1_epi8((char)0xc0)));
+  err = _mm_or_si128(err, _mm_cmpeq_epi8(
+    _mm_max_epu8(v, _mm_set1_epi8((char)0xf5)), v));
+
+  /* Restricted first continuation bytes. A signed comparison is correct for
+  continuation bytes; anything else is already in error. */
+
+  ltA0 = _mm_cmplt_epi8(v, _mm_set1_epi8((char)0xa0));
+  lt90 = _mm_cmplt_epi8(v, _mm_set1_epi8((char)0x90));
+  err = _mm_or_si128(err, _mm_and_si128(ltA0,
+    _mm_cmpeq_epi8(p1, _mm_set1_epi8((char)0xe0))));
+  err = _mm_or_si128(err, _mm_andnot_si128(ltA0,
+    _mm_cmpeq_epi8(p1, _mm_set1_epi8((char)0xed))));
+  err = _mm_or_si128(err, _mm_and_si128(lt90,
+    _mm_cmpeq_epi8(p1, _mm_set1_epi8((char)0xf0))));
+  err = _mm_or_si128(err, _mm_andnot_si128(lt90,
+    _mm_cmpeq_epi8(p1, _mm_set1_epi8((char)0xf4))));
+
+  *bad = (usint)_mm_movemask_epi8(err);
+  }
+
+return starts;
+}
+
+
+__attribute__((target("avx2"))) static inline usint
+block_avx2(const uschar *p, usint *bad, BOOL check, BOOL first)
+{
+__m256i v = _mm256_loadu_si256((const __m256i *)p);
+__m256i cont = _mm256_cmpeq_epi8(
+  _mm256_and_si256(v, _mm256_set1_epi8((char)0xc0)),
+  _mm256_set1_epi8((char)0x80));
+usint starts = ~(usint)_mm256_movemask_epi8(cont);
+
+*bad = 0;
+if (check)
+  {
+  __m256i p1, p2, p3, req, err, lt90, ltA0;
+
+  /* Shifting bytes across the two 128-bit lanes needs a permutation; z has
+  zeros in its low lane and the low lane of v in its high lane. */
+
+  if (first)
+    {
+    __m256i z = _mm256_permute2x128_si256(v, v, 0x08);
+    p1 = _mm256_alignr_epi8(v, z, 15);
+    p2 = _mm256_alignr_epi8(v, z, 14);
+    p3 = _mm256_alignr_epi8(v, z, 13);
+    }
+  else
+    {
+    p1 = _mm256_loadu_si256((const __m256i *)(p - 1));
+    p2 = _mm256_loadu_si256((const __m256i *)(p - 2));
+    p3 = _mm256_loadu_si256((const __m256i *)(p - 3));
+    }
+
+  if (_mm256_movemask_epi8(_mm256_or_si256(v, p3)) == 0) return starts;
+
+  req = _mm256_or_si256(
+    _mm256_cmpeq_epi8(_mm256_and_si256(p1, _mm256_set1_epi8((char)0xc0)),
+      _mm256_set1_epi8((char)0xc0)),
+    _mm256_or_si256(
+      _mm256_cmpeq_epi8(_mm256_and_si256(p2, _mm256_set1_epi8((char)0xe0)),
+        _mm256_set1_epi8((char)0xe0)),
+      _mm256_cmpeq_epi8(_mm256_and_si256(p3, _mm256_set1_epi8((char)0xf0)),
+        _mm256_set1_epi8((char)0xf0))));
+  err = _mm256_xor_si256(req, cont);
+
+  err = _mm256_or_si256(err, _mm256_cmpeq_epi8(
+    _mm256_and_si256(v, _mm256_set1_epi8((char)0xfe)),
+    _mm256_set1_epi8((char)0xc0)));
+  err = _mm256_or_si256(err, _mm256_cmpeq_epi8(
+    _mm256_max_epu8(v, _mm256_set1_epi8((char)0xf5)), v));
+
+  ltA0 = _mm256_cmpgt_epi8(_mm256_set1_epi8((char)0xa0), v);
+  lt90 = _mm256_cmpgt_epi8(_mm256_set1_epi8((char)0x90), v);
+  err = _mm256_or_si256(err, _mm256_and_si256(ltA0,
+    _mm256_cmpeq_epi8(p1, _mm256_set1_epi8((char)0xe0))));
+  err = _mm256_or_si256(err, _mm256_andnot_si256(ltA0,
+    _mm256_cmpeq_epi8(p1, _mm256_set1_epi8((char)0xed))));
+  err = _mm256_or_si256(err, _mm256_and_si256(lt90,
+    _mm256_cmpeq_epi8(p1, _mm256_set1_epi8((char)0xf0))));
+  err = _mm256_or_si256(err, _mm256_andnot_si256(lt90,
+    _mm256_cmpeq_epi8(p1, _mm256_set1_epi8((char)0xf4))));
+
+  *bad = (usint)_mm256_movemask_epi8(err);
+  }
+
+return starts;
+}
+
+
+/* Count the bits in a block's bit map. This is done by hand because
+__builtin_popcount() may be a function call when the POPCNT instruction is not
+assumed. */
+
+static inline usint
+bitcount(usint x)
+{
+x = x - ((x >> 1) & 0x55555555u);
+x = (x & 0x33333333u) + ((x >> 2) & 0x33333333u);
+x = (x + (x >> 4)) & 0x0f0f0f0fu;
+return (x * 0x01010101u) >> 24;
+}
+
+
+/* This is the scanning loop for the vector kernels. It is inlined into each of
+them, so that the block function is inlined too. A short last block is handled
+by re-reading the last whole block and shifting the results, or, if the range
+is too short for that, by copying it into a buffer with zeros around it. A
+character that is cut short by the end of the range is found by looking at the
+last three bytes. */
+
+static inline __attribute__((always_inline)) usint
+scan_blocks(const uschar *s, usint len, usint n, usint *chars, BOOL check,
+  usint width, blockfn *block)
+{
+uschar buffer[8 + 32];
+usint count = 0;
+
+for (usint q = 0; q < len; q += width)
+  {
+  const uschar *p = s + q;
+  usint rem = len - q;
+  usint mask = ~(usint)0 >> (32 - ((rem < width)? rem : width));
+  usint shift = 0;
+  usint starts, bad, k;
+
+  if (rem < width)
+    {
+    if (len >= width + 3 || (len >= width && !check))
+      {
+      shift = width - rem;
+      p -= shift;
+      }
+    else
+      {
+      usint back = (q < 8)? q : 8;
+      memset(buffer, 0, sizeof(buffer));
+      memcpy(buffer + 8 - back, p - back, back);
+      memcpy(buffer + 8, p, rem);
+      p = buffer + 8;
+      }
+    }
+
+  starts = (block(p, &bad, check, p == s) >> shift) & mask;
+  bad = (bad >> shift) & mask;
+  k = bitcount(starts);
+
+  /* If the nth character starts in this block, find it. Only the bytes up to
+  and including its first byte matter. */
+
+  if (count + k > n)
+    {
+    usint x;
+    for (k = n - count; k > 0; k--) starts &= starts - 1;
+    x = __builtin_ctz(starts);
+    if ((bad & (~(usint)0 >> (31 - x))) != 0) return SCAN_BAD;
+    *chars = n;
+    return q + x;
+    }
+
+  if (bad != 0) return SCAN_BAD;
+  count += k;
+  }
+
+if (check)
+  {
+  for (usint i = (len > 3)? len - 3 : 0; i < len; i++)
+    if (s[i] >= 0xc0 && i + utf8_table4[s[i] & 0x3f] >= len) return SCAN_BAD;
+  }
+
+*chars = count;
+return len;
+}
+
+
+__attribute__((target("sse2"))) static usint
+scan_sse2(const uschar *s, usint len, usint n, usint *chars, BOOL check)
+{
+return scan_blocks(s, len, n, chars, check, 16, block_sse2);
+}
+
+__attribute__((target("avx2"))) static usint
+scan_avx2(const uschar *s, usint len, usint n, usint *chars, BOOL check)
+{
+return scan_blocks(s, len, n, chars, check, 32, block_avx2);
+}
+
+#endif  /* UTF8_X86 */
+
+
+/* The available kernels, best first. */
+
+typedef struct {
+  const char *name;
+  scanfn     *scan;
+} kernelstr;
+
+static kernelstr kernels[] = {
+#ifdef UTF8_X86
+  { "avx2",     scan_avx2 },
+  { "sse2",     scan_sse2 },
+#endif
+  { "portable", scan_portable }
+};
+
+static kernelstr *kernel = NULL;
+
+
+
+/*************************************************
+*           Select a UTF-8 scanning kernel       *
+*************************************************/
+
+/* This is called with a NULL argument to select the best kernel the first time
+one is needed, or with a kernel name, to compare them. It can be called
+again to change the selection.
+
+Argument:   a kernel name, or NULL for the best available one
+Returns:    the name of the selected kernel, or NULL if the named kernel is
+              not known or not supported by this processor
+*/
+
+const char *
+utf8_kernel(const char *name)
+{
+for (usint i = 0; i < sizeof(kernels)/sizeof(kernelstr); i++)
+  {
+  kernelstr *k = kernels + i;
+  if (name != NULL && strcmp(name, k->name) != 0) continue;
+#ifdef UTF8_X86
+  if (k->scan == scan_avx2 && !__builtin_cpu_supports("avx2")) continue;
+  if (k->scan == scan_sse2 && !__builtin_cpu_supports("sse2")) continue;
+#endif
+  kernel = k;
+  return k->name;
+  }
+return NULL;
+}
+
+
+/* Run the selected kernel, or the portable one for a short range. */
+
+static usint
+scan(const uschar *s, usint len, usint n, usint *chars, BOOL check)
+{
+if (len < SCAN_MIN) return scan_portable(s, len, n, chars, check);
+if (kernel == NULL) (void)utf8_kernel(NULL);
+return kernel->scan(s, len, n, chars, check);
+}
+
+
+
+/*************************************************
+*      Count characters in a UTF-8 byte range     *
+*************************************************/
+
+/* The result is the same as counting with SKIPCHAR(). The line flags say
+whether the text is already known to be valid or invalid UTF-8. The range must
+not end inside a character when lf_utf8 is given.
+
+Arguments:
+  s          start of the byte range
+  len        its length
+  flags      line flags (lf_utf8 or lf_badutf8 are relevant)
+
+Returns:     the number of characters
+*/
+
+usint
+utf8_count(uschar *s, usint len, usint flags)
+{
+usint chars = 0;
+uschar *e;
+
+if ((flags & lf_badutf8) == 0 &&
+    scan(s, len, ~(usint)0, &chars, (flags & lf_utf8) == 0) != SCAN_BAD)
+  return chars;
+
+for (e = s + len, chars = 0; s < e; chars++) { SKIPCHAR(s, e); }
+return chars;
+}
+
+
+
+/*************************************************
+*   Find the offset of a character in UTF-8      *
+*************************************************/
+
+/* The result is the same as skipping n characters with SKIPCHAR(). If there
+are fewer than n characters, the yield is as if the range were followed by
+spaces. The flags are as for utf8_count().
+
+Arguments:
+  s          start of the byte range
+  len        its length
+  n          the character number
+  flags      line flags (lf_utf8 or lf_badutf8 are relevant)
+
+Returns:     the byte offset
+*/
+
+usint
+utf8_offset(uschar *s, usint len, usint n, usint flags)
+{
+usint chars = 0;
+usint offset = SCAN_BAD;
+uschar *p, *e;
+
+if ((flags & lf_badutf8) == 0)
+  offset = scan(s, len, n, &chars, (flags & lf_utf8) == 0);
+if (offset != SCAN_BAD) return offset + n - chars;
+
+for (p = s, e = s + len; n > 0 && p < e; n--) { SKIPCHAR(p, e); }
+return p - s + n;
+}
+
+
+
+/*************************************************
+*            Check for valid UTF-8               *
+*************************************************/
+
+/* This is used to check lines as they are read, so that they can be flagged.
+
+Arguments:
+  s          start of the byte range
+  len        its length
+
+Returns:     TRUE if the bytes are valid UTF-8
+*/
+
+BOOL
+utf8_valid(uschar *s, usint len)
+{
+usint chars;
+return scan(s, len, ~(usint)0, &chars, TRUE) != SCAN_BAD;
+}
+
 /* End of utf8.c */
@@ -0,0 +1,351 @@
+/*************************************************
+*       The E text editor - 3rd incarnation      *
+*************************************************/
+
+/* Copyright (c) University of Cambridge, 1991 - 2026 */
+
+/* Written by Philip Hazel, starting November 1991 */
+/* This file last modified: October 2026 */
+
+/* This file is not part of NE itself. It is an auxiliary program that compares
+the UTF-8 scanning kernels in utf8.c with the SKIPCHAR() macro, which is what
+NE used for counting characters and finding offsets before the kernels
+existed, and with utf82ord() for checking validity. It first checks that the
+kernels give the same results as the macro for a large number of random
+strings, and then times them on some synthetic texts, split into short lines
+and as one long line. It is built by "make utf8bench" in the top-level
+directory. The output has one line per measurement:
+
+  <text> <line length> <operation> <method> <MB per second>
+
+The argument, if present, is the size of each text in megabytes. */
+
+#include "ehdr.h"
+#include <time.h>
+
+BOOL allow_wide = TRUE;     /* Used by the macros */
+
+static const char *kernel_names[] = { "avx2", "sse2", "portable" };
+
+#define KERNEL_COUNT (int)(sizeof(kernel_names)/sizeof(char *))
+#define SHORT_LINE   80
+
+
+/* Sample characters for the texts; each text is made from random choices from
+one of these lists. */
+
+static const char *sample_ascii[] = {
+  "the ", "quick ", "brown ", "fox ", "jumps ", "over ", "lazy ", "dogs. " };
+
+static const char *sample_latin[] = {
+  "caf\xc3\xa9 ", "na\xc3\xafve ", "stra\xc3\x9f" "e ", "the ", "and ",
+  "gar\xc3\xa7on ", "\xc3\xa0 ", "fin. " };
+
+static const char *sample_cjk[] = {
+  "\xe6\x97\xa5", "\xe6\x9c\xac", "\xe8\xaa\x9e", "\xe6\x96\x87",
+  "\xe5\xad\x97", "\xe3\x80\x82", "\xe3\x81\xae", " " };
+
+static const char *sample_emoji[] = {
+  "\xf0\x9f\x98\x80", "\xf0\x9f\x8e\x89", "ok ", "\xe2\x82\xac", "\xc2\xa3",
+  "\xf0\x9d\x84\x9e", "x", " " };
+
+static const char *sample_invalid[] = {
+  "\xe9t\xe9 ", "\xc3\xa9t\xc3\xa9 ", "\x80", "\xed\xa0\x80", "ok ",
+  "\xc0\xaf", "\xf4\x90\x80\x80", "\xe2\x82" };
+
+typedef struct {
+  const char  *name;
+  const char **samples;
+} textstr;
+
+static textstr texts[] = {
+  { "ascii",   sample_ascii },
+  { "latin",   sample_latin },
+  { "cjk",     sample_cjk },
+  { "emoji",   sample_emoji },
+  { "invalid", sample_invalid }
+};
+
+
+
+/*************************************************
+*            Scalar reference functions          *
+*************************************************/
+
+static usint
+macro_count(uschar *s, usint len)
+{
+uschar *e = s + len;
+usint n = 0;
+while (s < e)
+  {
+  SKIPCHAR(s, e);
+  n++;
+  }
+return n;
+}
+
+static usint
+macro_offset(uschar *s, usint len, usint n)
+{
+uschar *p = s;
+uschar *e = s + len;
+while (n > 0 && p < e)
+  {
+  SKIPCHAR(p, e);
+  n--;
+  }
+return p - s + n;
+}
+
+/* Validity as RFC 3629 defines it; utf82ord() does not exclude surrogates, or
+values above 0x10ffff, and it does not check for the end of the string. */
+
+static BOOL
+ord_valid(uschar *s, usint len)
+{
+uschar *e = s + len;
+while (s < e)
+  {
+  int c = *s;
+  int n = (c < 0xc0)? 1 : utf8_table4[c & 0x3f] + 1;
+  if (s + n > e) return FALSE;
+  n = utf82ord(s, &c);
+  if (n <= 0) return FALSE;
+  if ((c >= 0xd800 && c <= 0xdfff) || c > 0x10ffff) return FALSE;
+  s += n;
+  }
+return TRUE;
+}
+
+
+
+/*************************************************
+*                   Timing                       *
+*************************************************/
+
+static double
+now(void)
+{
+struct timespec ts;
+clock_gettime(CLOCK_MONOTONIC, &ts);
+return ts.tv_sec + ts.tv_nsec/1e9;
+}
+
+/* The operations that are timed. Each is applied to every line of a text, and
+the results are summed to make sure they are used. */
+
+enum { op_count, op_countvalid, op_offset, op_valid };
+static const char *op_names[] = { "count", "count-known", "offset", "validate" };
+
+static usint
+run(int op, BOOL macro, uschar *text, usint size, usint linelen)
+{
+usint sum = 0;
+for (usint i = 0; i < size; i += linelen)
+  {
+  uschar *s = text + i;
+  usint len = (size - i < linelen)? size - i : linelen;
+  switch (op)
+    {
+    case op_count:
+    sum += macro? macro_count(s, len) : utf8_count(s, len, 0);
+    break;
+
+    case op_countvalid:
+    sum += macro? macro_count(s, len) : utf8_count(s, len, lf_utf8);
+    break;
+
+    case op_offset:
+    sum += macro? macro_offset(s, len, len/3) : utf8_offset(s, len, len/3, 0);
+    break;
+
+    case op_valid:
+    sum += macro? ord_valid(s, len) : utf8_valid(s, len);
+    break;
+    }
+  }
+return sum;
+}
+
+static void
+timeit(const char *textname, int op, const char *method, uschar *text,
+  usint size, usint linelen)
+{
+BOOL macro = strcmp(method, "macro") == 0;
+double start = now();
+double elapsed;
+int reps = 0;
+volatile usint sink;
+
+do
+  {
+  sink = run(op, macro, text, size, linelen);
+  reps++;
+  elapsed = now() - start;
+  }
+while (elapsed < 0.2);
+
+(void)sink;
+printf("%-8s %7u %-12s %-9s %9.1f\n", textname, linelen, op_names[op], method,
+  (double)size * reps / elapsed / 1e6);
+}
+
+
+
+/*************************************************
+*         Check kernels against the macro        *
+*************************************************/
+
+/* Random strings are made from valid characters of all lengths, with some
+bytes that are likely to be interesting mixed in, except in every third string.
+Every kernel must agree with the macro for counting and for every offset, and
+with the portable kernel for validity. The known-valid shortcut is checked for
+strings that are valid. */
+
+static const int check_chars[] = { 0x7f, 0x7ff, 0xffff, 0x10ffff };
+
+static const uschar check_bytes[] = {
+  'a', ' ', 0x7f, 0x80, 0x8f, 0x90, 0x9f, 0xa0, 0xbf, 0xc0, 0xc1, 0xc2, 0xdf,
+  0xe0, 0xe1, 0xed, 0xee, 0xef, 0xf0, 0xf1, 0xf4, 0xf5, 0xf8, 0xfc, 0xfe, 0xff };
+
+static int
+check(void)
+{
+uschar s[200];
+int errors = 0;
+
+srand(1);
+for (int trial = 0; trial < 200000 && errors < 10; trial++)
+  {
+  usint max = rand() % (sizeof(s) - 4);
+  usint len = 0;
+  usint count;
+  uschar *t;
+  BOOL valid;
+
+  while (len < max)
+    {
+    if (trial % 3 != 0 && rand() % 16 == 0)
+      s[len++] = check_bytes[rand() % sizeof(check_bytes)];
+    else
+      {
+      int c = rand() % (check_chars[rand() % 4] + 1);
+      if (c >= 0xd800 && c <= 0xdfff) c = 'b';
+      len += ord2utf8(c, s + len);
+      }
+    }
+
+  /* Copy to a block of exactly the right size, so that a memory checker
+  can catch any reading outside it. */
+
+  t = malloc(len + (len == 0));
+  memcpy(t, s, len);
+
+  count = macro_count(t, len);
+  (void)utf8_kernel("portable");
+  valid = utf8_valid(t, len);
+
+  for (int k = 0; k < KERNEL_COUNT; k++)
+    {
+    if (utf8_kernel(kernel_names[k]) == NULL) continue;
+    if (utf8_count(t, len, 0) != count ||
+        (valid && utf8_count(t, len, lf_utf8) != count) ||
+        utf8_valid(t, len) != valid)
+      {
+      printf("** %s: count or validity wrong for trial %d\n", kernel_names[k],
+        trial);
+      errors++;
+      }
+    for (usint n = 0; n <= count + 1; n++)
+      {
+      if (utf8_offset(t, len, n, 0) != macro_offset(t, len, n) ||
+          (valid && utf8_offset(t, len, n, lf_utf8) != macro_offset(t, len, n)))
+        {
+        printf("** %s: offset of %u wrong for trial %d\n", kernel_names[k], n,
+          trial);
+        errors++;
+        break;
+        }
+      }
+    }
+
+  if (valid != ord_valid(t, len))
+    {
+    printf("** validity differs from utf82ord() for trial %d\n", trial);
+    errors++;
+    }
+
+  free(t);
+  }
+
+return errors;
+}
+
+
+
+/*************************************************
+*                 Main program                   *
+*************************************************/
+
+int
+main(int argc, char **argv)
+{
+usint size = ((argc > 1)? atoi(argv[1]) : 4) * 1024 * 1024;
+uschar *text = malloc(size + 8);
+const char *best = utf8_kernel(NULL);
+
+if (text == NULL)
+  {
+  printf("** Failed to get %u bytes\n", size);
+  return 1;
+  }
+
+printf("Best kernel: %s\n", best);
+if (check() != 0) return 1;
+printf("Kernels agree with the macros\n");
+
+for (usint t = 0; t < sizeof(texts)/sizeof(textstr); t++)
+  {
+  usint used = 0;
+
+  /* Fill the text with random samples. Each short line is padded with spaces
+where the next sample does not fit, so that lines do not end inside a
+character. */
+
+  srand(t);
+  while (used < size)
+    {
+    const char *sample = texts[t].samples[rand() % 8];
+    usint n = strlen(sample);
+    usint end = used - used % SHORT_LINE + SHORT_LINE;
+    if (end > size) end = size;
+    if (used + n > end)
+      {
+      memset(text + used, ' ', end - used);
+      used = end;
+      continue;
+      }
+    memcpy(text + used, sample, n);
+    used += n;
+    }
+
+  for (int op = op_count; op <= op_valid; op++)
+    {
+    if (op == op_countvalid && texts[t].samples == sample_invalid) continue;
+    for (usint linelen = SHORT_LINE; linelen != 0;
+         linelen = (linelen == SHORT_LINE)? size : 0)
+      {
+      timeit(texts[t].name, op, "macro", text, size, linelen);
+      for (int k = 0; k < KERNEL_COUNT; k++)
+        if (utf8_kernel(kernel_names[k]) != NULL)
+          timeit(texts[t].name, op, kernel_names[k], text, size, linelen);
+      }
+    }
+  }
+
+free(text);
+return 0;
+}
+
+/* End of utf8bench.c */